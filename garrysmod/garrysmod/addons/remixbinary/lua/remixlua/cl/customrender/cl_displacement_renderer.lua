@@ -17,6 +17,7 @@ local hasLoaded = false
 local shouldReload = false
 local dispStats = { rendered = 0, total = 0 }
 local dispBins = {}
+local cullIndexed = false -- dispMeshes are registered in the native "displacements" cull index
 
 -- Debug helper function
 local DebugPrint = (RenderCore and RenderCore.CreateDebugPrint)
@@ -40,7 +41,149 @@ local function IsMaterialAllowedName(matName)
     return true
 end
 
+-- Registers every displacement mesh in the native BVH so the render loop can ask for the
+-- visible ones directly instead of walking every bin
+local function IndexDisplacements()
+    cullIndexed = false
+    if not istable(RemixCull) then return end
+    RemixCull.ClearIndex("displacements")
+    local ids, mins, maxs = {}, {}, {}
+    for id, dispData in ipairs(dispMeshes) do
+        ids[id], mins[id], maxs[id] = id, dispData.mins, dispData.maxs
+    end
+    RemixCull.AddItems("displacements", ids, mins, maxs)
+    cullIndexed = true
+end
+
+local function ResetCullIndex()
+    cullIndexed = false
+    if istable(RemixCull) then RemixCull.ClearIndex("displacements") end
+end
+
+local NATIVE_BATCH_VERTICES = 9999 -- multiple of 3 below the 10000 vertex mesh limit
+
+local function AddToBin(key, dispData)
+    local bin = dispBins[key]
+    if not bin then
+        bin = (RenderCore and RenderCore.CreateBin) and RenderCore.CreateBin() or { mins = Vector(math.huge, math.huge, math.huge), maxs = Vector(-math.huge, -math.huge, -math.huge), items = {} }
+        dispBins[key] = bin
+    end
+    table.insert(bin.items, dispData)
+    if RenderCore and RenderCore.UpdateBinBounds then
+        RenderCore.UpdateBinBounds(bin, dispData.mins, dispData.maxs)
+    else
+        local mins, maxs = dispData.mins, dispData.maxs
+        if mins.x < bin.mins.x then bin.mins.x = mins.x end
+        if mins.y < bin.mins.y then bin.mins.y = mins.y end
+        if mins.z < bin.mins.z then bin.mins.z = mins.z end
+        if maxs.x > bin.maxs.x then bin.maxs.x = maxs.x end
+        if maxs.y > bin.maxs.y then bin.maxs.y = maxs.y end
+        if maxs.z > bin.maxs.z then bin.maxs.z = maxs.z end
+    end
+end
+
+-- Uploads a finished native build in frame-budgeted batches
+local function UploadNativeDisplacements(result, cancelToken, startTime)
+    dispFaces = {}
+    dispMeshes = {}
+    ResetCullIndex()
+    dispBins = {}
+    hasLoaded = false
+    totalDisplacements = result.displacements
+
+    if #result.groups == 0 then
+        print("[Displacement Renderer] No displacements found in map")
+        RemixWorld.ReleaseDisplacements()
+        hasLoaded = true
+        return
+    end
+
+    print(string.format("[Displacement Renderer] Tessellated %d displacements into %d batches natively",
+        result.displacements, #result.groups))
+
+    local co = coroutine.create(function()
+        local budgetStart = SysTime()
+        for index, group in ipairs(result.groups) do
+            -- A newer build owns the native buffers now; leave them alone
+            if cancelToken and cancelToken.cancelled then return end
+
+            local mat = RenderCore.GetMaterial and RenderCore.GetMaterial(group.material) or Material(group.material)
+            local center = (group.mins + group.maxs) * 0.5
+            local first = 1
+            while first <= group.vertexCount do
+                local count = math.min(NATIVE_BATCH_VERTICES, group.vertexCount - first + 1)
+                local batchMesh = Mesh(mat)
+                mesh.Begin(batchMesh, MATERIAL_TRIANGLES, count / 3)
+                RemixWorld.EmitDisplacementGroup(index, first, count)
+                mesh.End()
+                first = first + count
+
+                if RenderCore and RenderCore.TrackMesh then
+                    RenderCore.TrackMesh(batchMesh)
+                end
+
+                local dispData = {
+                    mesh = batchMesh,
+                    material = mat,
+                    mins = group.mins,
+                    maxs = group.maxs,
+                    center = center
+                }
+                table.insert(dispMeshes, dispData)
+                AddToBin(group.bin, dispData)
+            end
+
+            loadProgress = index / #result.groups
+            if SysTime() - budgetStart > 0.003 then
+                coroutine.yield()
+                budgetStart = SysTime()
+            end
+        end
+
+        RemixWorld.ReleaseDisplacements()
+        IndexDisplacements()
+        print(string.format("[Displacement Renderer] Created %d batched displacement meshes in %.2f seconds",
+            #dispMeshes, SysTime() - startTime))
+        hasLoaded = true
+        dispStats.total = #dispMeshes
+    end)
+
+    local function Step()
+        if coroutine.status(co) == "dead" then return end
+        local ok, err = coroutine.resume(co)
+        if not ok then
+            ErrorNoHalt("[Displacement Renderer] Native build error: " .. tostring(err) .. "\n")
+            return
+        end
+        if coroutine.status(co) ~= "dead" then
+            timer.Simple(0, Step)
+        end
+    end
+    Step()
+end
+
+-- Native path: the binary module tessellates every displacement and merges them per material
+-- and bin, so a bin costs one mesh per material instead of one mesh per displacement.
+local function LoadNativeDisplacements(cancelToken)
+    if not istable(RemixWorld) or not RemixWorld.BuildDisplacements then return false end
+    if not (RenderCore.OpenNativeMap and RenderCore.OpenNativeMap()) then return false end
+
+    local startTime = SysTime()
+    hasLoaded = false
+    loadProgress = 0
+    return RenderCore.RunNativeBuild("displacements", {
+        binSize = cvarBinSize:GetInt(),
+        whitelist = cvarWhitelist:GetString(),
+        blacklist = cvarBlacklist:GetString(),
+        cache = RenderCore.UseGeometryCache == nil or RenderCore.UseGeometryCache()
+    }, cancelToken, function(result)
+        UploadNativeDisplacements(result, cancelToken, startTime)
+    end)
+end
+
 function LoadDisplacements(cancelToken)
+    if LoadNativeDisplacements(cancelToken) then return end
+
     if not NikNaks or not NikNaks.CurrentMap then
         print("[Displacement Renderer] ERROR: NikNaks not available or map not loaded")
         return
@@ -48,6 +191,7 @@ function LoadDisplacements(cancelToken)
 
     dispFaces = {}
     dispMeshes = {}
+    ResetCullIndex()
     hasLoaded = false
     
     local okFaces, dispFacesList = pcall(function() return NikNaks.CurrentMap:GetDisplacmentFaces() end)
@@ -113,18 +257,15 @@ function CreateDispMeshes(cancelToken)
         if not okVerts then vertexData = nil end
         
         if vertexData then
-            local valid = true
-            if RenderCore and RenderCore.ValidateVertex then
-                for _, v in ipairs(vertexData) do
-                    if not RenderCore.ValidateVertex(v.pos) then
-                        valid = false
-                        break
-                    end
+            -- One validation pass also yields the bounds
+            local boundsMins, boundsMaxs
+            if RenderCore and RenderCore.ValidateVertices then
+                local rejectedCount
+                rejectedCount, boundsMins, boundsMaxs = RenderCore.ValidateVertices(vertexData)
+                if rejectedCount > 0 then
+                    continue
                 end
             end
-            if not valid then
-                continue
-            end
             local mat = face:GetMaterial()
             local matName = mat and mat:GetName()
             if matName and not IsMaterialAllowedName(matName) then
@@ -136,8 +277,9 @@ function CreateDispMeshes(cancelToken)
             local faceMesh = Mesh(mat)
             
             mesh.Begin(faceMesh, MATERIAL_TRIANGLES, #vertexData / 3)
-            local mins = Vector(math.huge, math.huge, math.huge)
-            local maxs = Vector(-math.huge, -math.huge, -math.huge)
+            local mins = boundsMins or Vector(math.huge, math.huge, math.huge)
+            local maxs = boundsMaxs or Vector(-math.huge, -math.huge, -math.huge)
+            local trackBounds = boundsMins == nil
             
             for _, vert in ipairs(vertexData) do
                 mesh.Position(vert.pos)
@@ -146,12 +288,14 @@ function CreateDispMeshes(cancelToken)
                 mesh.TexCoord(1, vert.u1, vert.v1)
                 mesh.Color(255, 255, 255, 255)
                 mesh.AdvanceVertex()
-                if vert.pos.x < mins.x then mins.x = vert.pos.x end
-                if vert.pos.y < mins.y then mins.y = vert.pos.y end
-                if vert.pos.z < mins.z then mins.z = vert.pos.z end
-                if vert.pos.x > maxs.x then maxs.x = vert.pos.x end
-                if vert.pos.y > maxs.y then maxs.y = vert.pos.y end
-                if vert.pos.z > maxs.z then maxs.z = vert.pos.z end
+                if trackBounds then
+                    if vert.pos.x < mins.x then mins.x = vert.pos.x end
+                    if vert.pos.y < mins.y then mins.y = vert.pos.y end
+                    if vert.pos.z < mins.z then mins.z = vert.pos.z end
+                    if vert.pos.x > maxs.x then maxs.x = vert.pos.x end
+                    if vert.pos.y > maxs.y then maxs.y = vert.pos.y end
+                    if vert.pos.z > maxs.z then maxs.z = vert.pos.z end
+                end
             end
             
             mesh.End()
@@ -167,22 +311,7 @@ function CreateDispMeshes(cancelToken)
             })
             local key = (RenderCore and RenderCore.GetBinKey) and RenderCore.GetBinKey(center, binSize)
                 or (math.floor(center.x / binSize) .. "," .. math.floor(center.y / binSize) .. "," .. math.floor(center.z / binSize))
-            local bin = dispBins[key]
-            if not bin then
-                bin = (RenderCore and RenderCore.CreateBin) and RenderCore.CreateBin() or { mins = Vector(math.huge, math.huge, math.huge), maxs = Vector(-math.huge, -math.huge, -math.huge), items = {} }
-                dispBins[key] = bin
-            end
-            table.insert(bin.items, dispMeshes[#dispMeshes])
-            if RenderCore and RenderCore.UpdateBinBounds then
-                RenderCore.UpdateBinBounds(bin, mins, maxs)
-            else
-                if mins.x < bin.mins.x then bin.mins.x = mins.x end
-                if mins.y < bin.mins.y then bin.mins.y = mins.y end
-                if mins.z < bin.mins.z then bin.mins.z = mins.z end
-                if maxs.x > bin.maxs.x then bin.maxs.x = maxs.x end
-                if maxs.y > bin.maxs.y then bin.maxs.y = maxs.y end
-                if maxs.z > bin.maxs.z then bin.maxs.z = maxs.z end
-            end
+            AddToBin(key, dispMeshes[#dispMeshes])
 
             if RenderCore and RenderCore.TrackMesh then
                 RenderCore.TrackMesh(faceMesh)
@@ -190,6 +319,7 @@ function CreateDispMeshes(cancelToken)
         end
     end
     
+    IndexDisplacements()
     print("[Displacement Renderer] Created " .. #dispMeshes .. " displacement meshes")
     hasLoaded = true
     dispStats.total = #dispMeshes
@@ -207,7 +337,22 @@ RenderCore.Register("PreDrawOpaqueRenderables", "DisplacementRenderer", function
     local distanceSkipped = 0
     
     local hasCullBox = (render and type(render.CullBox) == "function")
-    if hasCullBox then
+    if cullIndexed then
+        -- Native BVH: frustum and distance culling in one traversal
+        local wireframe = wireframeMode:GetBool()
+        for _, id in ipairs(RemixCull.Query("displacements", playerPos, useDistanceLimit and maxDistance or 0)) do
+            local dispData = dispMeshes[id]
+            local mat = wireframe and wireframeMaterial or dispData.material
+            if dispData.mesh and mat then
+                RenderCore.Submit({
+                    material = mat,
+                    mesh = dispData.mesh,
+                    translucent = false
+                })
+            end
+            renderedCount = renderedCount + 1
+        end
+    elseif hasCullBox then
         for key, bin in pairs(dispBins) do
             if render.CullBox(bin.mins, bin.maxs) then continue end
             for _, dispData in ipairs(bin.items) do
@@ -267,6 +412,7 @@ RenderCore.Register("ShutDown", "DisplacementRenderer_Cleanup", function()
     dispFaces = {}
     dispMeshes = {}
     dispBins = {}
+    ResetCullIndex()
     hasLoaded = false
     loadProgress = 0
 end)
@@ -278,7 +424,12 @@ end)
 
 -- Warning message when loading
 RenderCore.Register("HUDPaint", "DisplacementRendererLoading", function()
-    if not hasLoaded and loadProgress > 0 then
+    if hasLoaded then return end
+    local buildProgress = RenderCore.GetNativeBuildProgress and RenderCore.GetNativeBuildProgress("displacements")
+    if buildProgress then
+        local w, h = ScrW(), ScrH()
+        draw.SimpleText("Building Custom Displacements: " .. math.floor(buildProgress * 100) .. "%", "DermaLarge", w/2, h/2, Color(255, 255, 255), TEXT_ALIGN_CENTER, TEXT_ALIGN_CENTER)
+    elseif loadProgress > 0 then
         local w, h = ScrW(), ScrH()
         draw.SimpleText("Loading Custom Displacements: " .. math.floor(loadProgress * 100) .. "%", "DermaLarge", w/2, h/2, Color(255, 255, 255), TEXT_ALIGN_CENTER, TEXT_ALIGN_CENTER)
     end
@@ -298,6 +449,7 @@ RenderCore.RegisterRebuildSink("DisplacementsRebuild", function(token, reason)
     dispFaces = {}
     dispMeshes = {}
     dispBins = {}
+    ResetCullIndex()
     if RenderCore and RenderCore.DestroyTrackedMeshes then
         RenderCore.DestroyTrackedMeshes()
     end
@@ -13,7 +13,12 @@ local CONVARS = {
     MAT_WHITELIST = CreateClientConVar("rtx_mwr_mat_whitelist", "", true, false, "Comma-separated material name substrings to include"),
     MAT_BLACKLIST = CreateClientConVar("rtx_mwr_mat_blacklist", "toolsskybox,skybox/", true, false, "Comma-separated material name substrings to exclude"),
     PVS_CULL = CreateClientConVar("rtx_mwr_pvs_cull", "1", true, false, "Enable PVS-based chunk culling if available"),
-    DISTANCE = CreateClientConVar("rtx_mwr_distance", "0", true, false, "World chunk distance limit (0 = off)")
+    PORTAL_CULL = CreateClientConVar("rtx_mwr_portal_cull", "1", true, false, "Narrow PVS culling by portal flow from the camera when the map ships a .prt file (requires binary module)"),
+    DISTANCE = CreateClientConVar("rtx_mwr_distance", "0", true, false, "World chunk distance limit (0 = off)"),
+    LOD = CreateClientConVar("rtx_mwr_lod", "1", true, false, "Build simplified LOD meshes for distant chunks (requires binary module)"),
+    LOD_DISTANCE = CreateClientConVar("rtx_mwr_lod_distance", "4096", true, false, "Distance at which chunks switch to LOD 1 (LOD 2 at twice this)"),
+    MEGABATCH = CreateClientConVar("rtx_mwr_megabatch", "1", true, false, "Pack each material's geometry from neighbouring chunks into shared meshes (requires binary module)"),
+    MEGABATCH_EXTENT = CreateClientConVar("rtx_mwr_megabatch_extent", "8192", true, false, "Largest region one shared mesh may span, in units (0 = unbounded)")
 }
 
 -- Local Variables and Caches
@@ -31,6 +36,8 @@ local math_floor = math.floor
 local table_insert = table.insert
 local MAX_VERTICES = 10000
 local MAX_CHUNK_VERTS = 32768
+local LOD_RATIOS = {0.5, 0.25}
+local LOD_MIN_VERTICES = 768 -- below 256 triangles the extra meshes cost more than they save
 local function IsChunkVisibleByPVS(viewCluster, chunkClusters)
     if type(viewCluster) ~= "number" or not chunkClusters then return true end
     local map = NikNaks and NikNaks.CurrentMap
@@ -52,6 +59,87 @@ local function IsChunkVisibleByPVS(viewCluster, chunkClusters)
     return true
 end
 
+-- Native PVS: chunk cluster sets live in the binary module as bitmasks, so a frame costs one
+-- leaf lookup plus one word-wide AND per chunk instead of a Lua cluster loop per chunk.
+local nativeVisCache = {}
+
+local function HasNativeVisibility()
+    return istable(RemixBSP) and RemixBSP.GetVisibleChunks ~= nil
+        and RenderCore._nativeMap == game.GetMap() and RemixBSP.IsOpen()
+end
+
+local function ResetNativeVisibility()
+    nativeVisCache = {}
+    if istable(RemixBSP) and RemixBSP.ClearChunkClusters then
+        RemixBSP.ClearChunkClusters("opaque")
+        RemixBSP.ClearChunkClusters("translucent")
+    end
+end
+
+-- Registers a chunk's clusters on first sight; returns its index in the native set
+local function GetNativeChunkIndex(renderType, chunkMaterials)
+    local index = chunkMaterials._visIndex
+    if index then return index end
+    if not chunkMaterials._clusters then return nil end
+
+    index = RemixBSP.RegisterChunkClusters(renderType, chunkMaterials._clusters)
+    chunkMaterials._visIndex = index
+    -- The cached visible set predates this chunk
+    nativeVisCache[renderType] = nil
+    return index
+end
+
+local function GetNativeVisibleChunks(renderType, viewCluster)
+    local cache = nativeVisCache[renderType]
+    if cache and cache.cluster == viewCluster then return cache.visible end
+
+    local visible = RemixBSP.GetVisibleChunks(renderType, viewCluster)
+    nativeVisCache[renderType] = { cluster = viewCluster, visible = visible }
+    return visible
+end
+
+-- Portal flow from the camera through the map's .prt graph, tighter than the view cluster's
+-- PVS. nil when the map has no portal file or the flow ran over budget this frame.
+local function GetPortalVisibleChunks(renderType)
+    if not CONVARS.PORTAL_CULL:GetBool() or not RemixBSP.GetPortalVisibleChunks then return nil end
+
+    local visible = RemixBSP.GetPortalVisibleChunks(renderType)
+    if visible then
+        -- Not keyed by cluster: the module recomputes the flow whenever the view changes
+        nativeVisCache[renderType] = { visible = visible }
+    end
+    return visible
+end
+
+-- Native BVH over chunk bounds: once a build finishes every chunk gets a _cullId in the
+-- "world_opaque"/"world_translucent" cull index and a frame fetches the visible set in one call.
+local worldCullIndexed = false
+
+local function ResetWorldCullIndex()
+    worldCullIndexed = false
+    if istable(RemixCull) then
+        RemixCull.ClearIndex("world_opaque")
+        RemixCull.ClearIndex("world_translucent")
+    end
+end
+
+local function IndexWorldChunks()
+    ResetWorldCullIndex()
+    if not istable(RemixCull) then return end
+    for renderType, chunks in pairs(mapMeshes) do
+        local ids, mins, maxs = {}, {}, {}
+        for _, chunkMaterials in pairs(chunks) do
+            if chunkMaterials._mins and chunkMaterials._maxs then
+                local id = #ids + 1
+                chunkMaterials._cullId = id
+                ids[id], mins[id], maxs[id] = id, chunkMaterials._mins, chunkMaterials._maxs
+            end
+        end
+        RemixCull.AddItems("world_" .. renderType, ids, mins, maxs)
+    end
+    worldCullIndexed = true
+end
+
 -- Deprecated BuildMatcherList removed; use RenderCore.IsMaterialAllowed
 
 local function IsMaterialAllowed(matName)
@@ -70,15 +158,75 @@ local vertexBuffer = {
 }
 
 local function ValidateVertex(pos)
-    if RenderCore and RenderCore.ValidateVertex then
-        return RenderCore.ValidateVertex(pos)
-    end
     if not pos or not pos.x or not pos.y or not pos.z then return false end
     if pos.x ~= pos.x or pos.y ~= pos.y or pos.z ~= pos.z then return false end
     if math.abs(pos.x) > 16384 or math.abs(pos.y) > 16384 or math.abs(pos.z) > 16384 then return false end
     return true
 end
 
+-- rejectedCount, mins, maxs, rejected (see RenderCore.ValidateVertices)
+local function ValidateVertices(vertices)
+    if RenderCore and RenderCore.ValidateVertices then
+        return RenderCore.ValidateVertices(vertices)
+    end
+    local mins = Vector(math_huge, math_huge, math_huge)
+    local maxs = Vector(-math_huge, -math_huge, -math_huge)
+    local rejectedCount, rejected = 0, nil
+    for i, vert in ipairs(vertices) do
+        local pos = vert.pos
+        if ValidateVertex(pos) then
+            mins.x = math_min(mins.x, pos.x); mins.y = math_min(mins.y, pos.y); mins.z = math_min(mins.z, pos.z)
+            maxs.x = math_max(maxs.x, pos.x); maxs.y = math_max(maxs.y, pos.y); maxs.z = math_max(maxs.z, pos.z)
+        else
+            rejectedCount = rejectedCount + 1
+            rejected = rejected or {}
+            rejected[i] = true
+        end
+    end
+    return rejectedCount, mins, maxs, rejected
+end
+
+-- Triangulates faces and validates all their vertices in one pass. A face with any rejected
+-- vertex is dropped whole; returns the kept vertices and their bounds.
+local function CollectFaceVertices(faces)
+    local allVertices, ranges = {}, {}
+    for _, face in ipairs(faces) do
+        local verts = face:GenerateVertexTriangleData()
+        if verts and #verts > 0 then
+            local first = #allVertices
+            for i = 1, #verts do
+                allVertices[first + i] = verts[i]
+            end
+            ranges[#ranges + 1] = { first + 1, #allVertices }
+        end
+    end
+
+    local rejectedCount, mins, maxs, rejected = ValidateVertices(allVertices)
+    if rejectedCount == 0 then
+        return allVertices, mins, maxs
+    end
+
+    local kept = {}
+    for _, range in ipairs(ranges) do
+        local faceValid = true
+        for i = range[1], range[2] do
+            if rejected[i] then
+                faceValid = false
+                break
+            end
+        end
+        if faceValid then
+            for i = range[1], range[2] do
+                kept[#kept + 1] = allVertices[i]
+            end
+        end
+    end
+
+    -- Accepted vertices of dropped faces must not widen the bounds
+    local _, keptMins, keptMaxs = ValidateVertices(kept)
+    return kept, keptMins, keptMaxs
+end
+
 local function IsBrushEntity(face)
     if not face then return false end
     
@@ -103,6 +251,10 @@ local function IsSkyboxFace(face)
     local material = face:GetMaterial()
     if not material then return false end
     
+    if RenderCore and RenderCore.IsSkyboxMaterial then
+        return RenderCore.IsSkyboxMaterial(material)
+    end
+    
     local matName = material:GetName():lower()
     
     return matName:find("tools/toolsskybox") or
@@ -202,6 +354,228 @@ local function GetChunkKey(x, y, z)
     return x .. "," .. y .. "," .. z
 end
 
+-- Uploads one natively built group (or one of its LOD levels) in MAX_VERTICES sized meshes.
+-- Vertices go straight from the binary module into the mesh builder.
+local NATIVE_BATCH_VERTICES = math_floor((MAX_VERTICES - 1) / 3) * 3
+local function CreateNativeMeshBatch(groupIndex, vertexCount, material, level)
+    local meshes = {}
+    for first = 1, vertexCount, NATIVE_BATCH_VERTICES do
+        local count = math_min(NATIVE_BATCH_VERTICES, vertexCount - first + 1)
+        local newMesh = Mesh(material)
+        mesh.Begin(newMesh, MATERIAL_TRIANGLES, count / 3)
+        RemixWorld.EmitWorldGroup(groupIndex, first, count, level)
+        mesh.End()
+
+        table_insert(meshes, newMesh)
+        if RenderCore and RenderCore.TrackMesh then
+            RenderCore.TrackMesh(newMesh)
+        end
+    end
+    return meshes
+end
+
+local function GrowChunkBounds(chunkTable, mins, maxs)
+    local cmins, cmaxs = chunkTable._mins, chunkTable._maxs
+    if not cmins or not cmaxs then
+        chunkTable._mins = mins
+        chunkTable._maxs = maxs
+    else
+        cmins.x = math_min(cmins.x, mins.x)
+        cmins.y = math_min(cmins.y, mins.y)
+        cmins.z = math_min(cmins.z, mins.z)
+        cmaxs.x = math_max(cmaxs.x, maxs.x)
+        cmaxs.y = math_max(cmaxs.y, maxs.y)
+        cmaxs.z = math_max(cmaxs.z, maxs.z)
+    end
+end
+
+-- LOD meshes of one group, or nil when the build simplified nothing for it (too small, or
+-- simplification kept nothing). The levels themselves come with the build from the workers.
+local function CreateNativeGroupLODs(groupIndex, group, material)
+    if not group.lods or #group.lods == 0 then return nil end
+
+    local lods = {}
+    for level, count in ipairs(group.lods) do
+        lods[level] = CreateNativeMeshBatch(groupIndex, count, material, level)
+    end
+    return lods
+end
+
+local function UploadNativeGroup(index, group, useLod, chunkKey)
+    chunkKey = chunkKey or group.chunk
+    local chunks = group.translucent and mapMeshes.translucent or mapMeshes.opaque
+    local chunkTable = chunks[chunkKey]
+    if not chunkTable then
+        chunkTable = { _clusters = group.clusters }
+        chunks[chunkKey] = chunkTable
+    end
+
+    local material = RenderCore.GetMaterial(group.material)
+    chunkTable[group.material] = {
+        meshes = CreateNativeMeshBatch(index, group.vertexCount, material),
+        lods = useLod and CreateNativeGroupLODs(index, group, material) or nil,
+        material = material
+    }
+    GrowChunkBounds(chunkTable, group.mins, group.maxs)
+end
+
+-- Mega-batching: a batch holds whole groups of one material from neighbouring chunks and
+-- uploads them back to back into shared meshes, so it costs one draw per mesh where the
+-- per-chunk path needed one per group and slice. Each batch is culled as its own chunk.
+-- LOD levels concatenate the members' levels (members without one contribute full detail).
+-- Shared meshes obey the same per-mesh vertex limit as every other upload.
+local MEGABATCH_VERTICES = NATIVE_BATCH_VERTICES
+
+local function CreateNativeSharedMesh(material, members, levelOf)
+    local meshes = {}
+    local run, runCount = {}, 0
+
+    local function FlushRun()
+        if runCount == 0 then return end
+        local newMesh = Mesh(material)
+        mesh.Begin(newMesh, MATERIAL_TRIANGLES, runCount / 3)
+        for _, entry in ipairs(run) do
+            RemixWorld.EmitWorldGroup(entry.index, 1, entry.count, entry.level)
+        end
+        mesh.End()
+
+        table_insert(meshes, newMesh)
+        if RenderCore and RenderCore.TrackMesh then
+            RenderCore.TrackMesh(newMesh)
+        end
+        run, runCount = {}, 0
+    end
+
+    -- Members are never split (the planner keeps multi-group batches within the budget), so a
+    -- new mesh starts whenever the next member would not fit
+    for _, member in ipairs(members) do
+        local level = levelOf and levelOf(member) or 0
+        local count = level > 0 and member.lods[level] or member.vertexCount
+        if runCount + count > MEGABATCH_VERTICES then FlushRun() end
+        run[#run + 1] = { index = member.index, count = count, level = level }
+        runCount = runCount + count
+    end
+    FlushRun()
+    return meshes
+end
+
+local function UploadNativeBatch(batchIndex, batch, groups, useLod)
+    -- A single oversized group keeps the regular sliced upload
+    if #batch.groups == 1 then
+        local index = batch.groups[1]
+        UploadNativeGroup(index, groups[index], useLod, "b" .. batchIndex)
+        return
+    end
+
+    local chunks = batch.translucent and mapMeshes.translucent or mapMeshes.opaque
+    local chunkTable = { _clusters = batch.clusters, _mins = batch.mins, _maxs = batch.maxs }
+    chunks["b" .. batchIndex] = chunkTable
+
+    local members = {}
+    local levelCount = 0
+    for i, index in ipairs(batch.groups) do
+        local member = { index = index, vertexCount = groups[index].vertexCount }
+        if useLod and groups[index].lods then
+            member.lods = groups[index].lods
+            levelCount = math_max(levelCount, #member.lods)
+        end
+        members[i] = member
+    end
+
+    local material = RenderCore.GetMaterial(batch.material)
+    local lods = nil
+    for level = 1, levelCount do
+        local function levelOf(member)
+            return (member.lods and member.lods[level]) and level or 0
+        end
+        lods = lods or {}
+        lods[level] = CreateNativeSharedMesh(material, members, levelOf)
+    end
+
+    chunkTable[batch.material] = {
+        meshes = CreateNativeSharedMesh(material, members),
+        lods = lods,
+        material = material
+    }
+end
+
+-- Uploads a finished native build: one frame-budgeted coroutine turning groups into meshes
+local function UploadNativeWorld(world, cancelToken, startTime)
+    CONVARS.CHUNK_SIZE:SetInt(world.chunkSize)
+
+    local useLod = CONVARS.LOD:GetBool()
+    local batches = nil
+    if CONVARS.MEGABATCH:GetBool() and RemixWorld.PlanWorldBatches then
+        batches = RemixWorld.PlanWorldBatches(MEGABATCH_VERTICES, CONVARS.MEGABATCH_EXTENT:GetFloat())
+    end
+
+    local co = coroutine.create(function()
+        local budgetStart = SysTime()
+        local items = batches or world.groups
+        for index, item in ipairs(items) do
+            -- A newer build owns the native buffers now; leave them alone
+            if cancelToken and cancelToken.cancelled then return end
+
+            if batches then
+                UploadNativeBatch(index, item, world.groups, useLod)
+            else
+                UploadNativeGroup(index, item, useLod)
+            end
+
+            if SysTime() - budgetStart > 0.003 then
+                coroutine.yield()
+                budgetStart = SysTime()
+            end
+        end
+
+        RemixWorld.ReleaseWorldChunks()
+        IndexWorldChunks()
+        if batches then
+            print(string.format("[RTX Fixes] Uploaded %d native world groups as %d shared batches (%d faces) in %.2f seconds",
+                #world.groups, #batches, world.faces, SysTime() - startTime))
+        else
+            print(string.format("[RTX Fixes] Uploaded %d native world groups (%d faces) in %.2f seconds",
+                #world.groups, world.faces, SysTime() - startTime))
+        end
+    end)
+
+    local function StepBuilder()
+        if coroutine.status(co) == "dead" then return end
+        local ok, err = coroutine.resume(co)
+        if not ok then
+            ErrorNoHalt("[RTX Fixes] Native build coroutine error: " .. tostring(err) .. "\n")
+            RemixWorld.ReleaseWorldChunks()
+            return
+        end
+        if coroutine.status(co) ~= "dead" then
+            timer.Simple(0, StepBuilder)
+        end
+    end
+    StepBuilder()
+end
+
+-- Native counterpart of the NikNaks path below: filtering, binning and triangulation run on
+-- the binary module's worker threads in the background, only the mesh uploads stay
+-- frame-budgeted here.
+local function BuildNativeMapMeshes(cancelToken)
+    if not istable(RemixWorld) or not RemixWorld.BuildWorldChunks then return false end
+    if not (RenderCore.OpenNativeMap and RenderCore.OpenNativeMap()) then return false end
+
+    print("[RTX Fixes] Building chunked meshes (native)...")
+    local startTime = SysTime()
+
+    return RenderCore.RunNativeBuild("world", {
+        whitelist = CONVARS.MAT_WHITELIST:GetString(),
+        blacklist = CONVARS.MAT_BLACKLIST:GetString(),
+        cache = RenderCore.UseGeometryCache == nil or RenderCore.UseGeometryCache(),
+        -- Simplified on the workers as part of the build, not during the upload
+        lods = CONVARS.LOD:GetBool() and LOD_RATIOS or nil,
+        lodMinVertices = LOD_MIN_VERTICES
+    }, cancelToken, function(world)
+        UploadNativeWorld(world, cancelToken, startTime)
+    end)
+end
+
 -- Main Mesh Building Function
 local function BuildMapMeshes(cancelToken)
     -- Clean up existing meshes first (best-effort)
@@ -215,6 +589,15 @@ local function BuildMapMeshes(cancelToken)
                         end
                     end
                 end
+                if group.lods then
+                    for _, level in ipairs(group.lods) do
+                        for _, m in ipairs(level) do
+                            if m and m.Destroy then
+                                pcall(function() m:Destroy() end)
+                            end
+                        end
+                    end
+                end
             end
         end
     end
@@ -223,6 +606,10 @@ local function BuildMapMeshes(cancelToken)
         opaque = {},
         translucent = {},
     }
+    ResetNativeVisibility()
+    ResetWorldCullIndex()
+
+    if BuildNativeMapMeshes(cancelToken) then return end
     
     if not NikNaks or not NikNaks.CurrentMap then return end
 
@@ -320,38 +707,8 @@ local function BuildMapMeshes(cancelToken)
     local function CreateRegularMeshGroup(faces, material)
         if not faces or #faces == 0 or not material then return nil end
         
-        -- Track chunk bounds
-        local minBounds = Vector(math_huge, math_huge, math_huge)
-        local maxBounds = Vector(-math_huge, -math_huge, -math_huge)
-        
-        -- Collect and validate vertices
-        local allVertices = {}
-        for _, face in ipairs(faces) do
-            local verts = face:GenerateVertexTriangleData()
-            if verts then
-                local faceValid = true
-                for _, vert in ipairs(verts) do
-                    if not ValidateVertex(vert.pos) then
-                        faceValid = false
-                        break
-                    end
-                    
-                    -- Update bounds
-                    minBounds.x = math_min(minBounds.x, vert.pos.x)
-                    minBounds.y = math_min(minBounds.y, vert.pos.y)
-                    minBounds.z = math_min(minBounds.z, vert.pos.z)
-                    maxBounds.x = math_max(maxBounds.x, vert.pos.x)
-                    maxBounds.y = math_max(maxBounds.y, vert.pos.y)
-                    maxBounds.z = math_max(maxBounds.z, vert.pos.z)
-                end
-                
-                if faceValid then
-                    for _, vert in ipairs(verts) do
-                        table_insert(allVertices, vert)
-                    end
-                end
-            end
-        end
+        -- Collect and validate vertices, tracking chunk bounds
+        local allVertices, minBounds, maxBounds = CollectFaceVertices(faces)
         
         -- Check chunk size and split if needed
         local chunkSize = maxBounds - minBounds
@@ -361,22 +718,45 @@ local function BuildMapMeshes(cancelToken)
             -- Split into sub-chunks and process each
             local subChunks = SplitChunk(faces, CONVARS.CHUNK_SIZE:GetInt())
             local allMeshes = {}
+            local allLods = {}
             
             for _, subFaces in pairs(subChunks) do
-                local subMeshes = CreateRegularMeshGroup(subFaces, material)
+                local subMeshes, _, _, subLods = CreateRegularMeshGroup(subFaces, material)
                 if subMeshes then
                     for _, mesh in ipairs(subMeshes) do
                         table_insert(allMeshes, mesh)
                     end
+                    -- Sub-chunks that stopped simplifying early reuse their coarsest level
+                    for level = 1, #LOD_RATIOS do
+                        local source = (subLods and subLods[math_min(level, #subLods)]) or subMeshes
+                        allLods[level] = allLods[level] or {}
+                        for _, mesh in ipairs(source) do
+                            table_insert(allLods[level], mesh)
+                        end
+                    end
                 end
             end
             
-            return allMeshes
+            return allMeshes, nil, nil, allLods
         end
         
         -- Create mesh batches for this chunk
         local meshes = CreateMeshBatch(allVertices, material, MAX_VERTICES)
-        return meshes, minBounds, maxBounds
+
+        -- Simplified levels for distant rendering, built natively when available
+        local lods = nil
+        if CONVARS.LOD:GetBool() and istable(RemixWorld) and #allVertices >= LOD_MIN_VERTICES then
+            -- This chunk doesn't know where its neighbours meet it, so its outline stays locked
+            local ok, chain = pcall(RemixWorld.BuildLODChain, allVertices, LOD_RATIOS, nil, true)
+            if ok and istable(chain) and #chain > 0 then
+                lods = {}
+                for level, levelVerts in ipairs(chain) do
+                    lods[level] = CreateMeshBatch(levelVerts, material, MAX_VERTICES)
+                end
+            end
+        end
+
+        return meshes, minBounds, maxBounds, lods
     end
 
     -- Create combined meshes with frame-budgeted coroutine
@@ -395,10 +775,11 @@ local function BuildMapMeshes(cancelToken)
                 for matName, group in pairs(materials) do
                     if cancelToken and cancelToken.cancelled then return end
                     if group.faces and #group.faces > 0 then
-                        local meshes, mins, maxs = CreateRegularMeshGroup(group.faces, group.material)
+                        local meshes, mins, maxs, lods = CreateRegularMeshGroup(group.faces, group.material)
                         if meshes then
                             mapMeshes[renderType][chunkKey][matName] = {
                                 meshes = meshes,
+                                lods = lods,
                                 material = group.material
                             }
                             -- update chunk bounds
@@ -435,6 +816,7 @@ local function BuildMapMeshes(cancelToken)
                 end
             end
         end
+        IndexWorldChunks()
     end)
 
     -- Drive the coroutine over frames
@@ -470,7 +852,19 @@ local function RenderCustomWorld(translucent)
     local groups = translucent and mapMeshes.translucent or mapMeshes.opaque
     -- determine viewer cluster once (only if PVS culling enabled)
     local viewCluster = nil
-    if CONVARS.PVS_CULL:GetBool() then
+    local renderType = translucent and "translucent" or "opaque"
+    local nativeVis = CONVARS.PVS_CULL:GetBool() and HasNativeVisibility()
+    local nativeVisible = nil
+    if nativeVis then
+        nativeVisible = GetPortalVisibleChunks(renderType)
+        local ply = LocalPlayer and LocalPlayer() or nil
+        if not nativeVisible and ply and ply.GetPos then
+            viewCluster = RemixBSP.GetClusterForPoint(ply:GetPos())
+            if viewCluster >= 0 then
+                nativeVisible = GetNativeVisibleChunks(renderType, viewCluster)
+            end
+        end
+    elseif CONVARS.PVS_CULL:GetBool() then
         local ok = pcall(function()
             local map = NikNaks and NikNaks.CurrentMap
             if map and map.PointInLeaf and LocalPlayer then
@@ -492,24 +886,53 @@ local function RenderCustomWorld(translucent)
     local useDist = maxDist > 0
     local ply = LocalPlayer and LocalPlayer() or nil
     local eyePos = ply and ply.GetPos and ply:GetPos() or nil
+    local lodDist = CONVARS.LOD:GetBool() and CONVARS.LOD_DISTANCE:GetFloat() or 0
+    local useLod = lodDist > 0 and eyePos ~= nil
+    local lodDraws = 0
+    -- Frustum + distance culling of every chunk in one native BVH query
+    local cullVisible = worldCullIndexed
+        and RemixCull.QuerySet("world_" .. renderType, eyePos, useDist and maxDist or 0) or nil
     for _, chunkMaterials in pairs(groups) do
         chunksVisited = chunksVisited + 1
+        local lodLevel = 0
         -- frustum cull entire chunk by its AABB if available
         local cmins, cmaxs = chunkMaterials._mins, chunkMaterials._maxs
         if cmins and cmaxs then
-            if hasCullBox and render.CullBox(cmins, cmaxs) then
-                culledFrustum = culledFrustum + 1
-                continue
-            end
-            if useDist and eyePos then
-                local center = (cmins + cmaxs) * 0.5
-                if RenderCore and RenderCore.ShouldCullByDistance and RenderCore.ShouldCullByDistance(center, eyePos, maxDist) then
+            local cullId = cullVisible and chunkMaterials._cullId
+            if cullId then
+                if not cullVisible[cullId] then
                     culledFrustum = culledFrustum + 1
                     continue
                 end
+            else
+                if hasCullBox and render.CullBox(cmins, cmaxs) then
+                    culledFrustum = culledFrustum + 1
+                    continue
+                end
+                if useDist and eyePos then
+                    local center = (cmins + cmaxs) * 0.5
+                    if RenderCore and RenderCore.ShouldCullByDistance and RenderCore.ShouldCullByDistance(center, eyePos, maxDist) then
+                        culledFrustum = culledFrustum + 1
+                        continue
+                    end
+                end
+            end
+            if useLod then
+                local distSqr = eyePos:DistToSqr((cmins + cmaxs) * 0.5)
+                if distSqr > (lodDist * 2) * (lodDist * 2) then
+                    lodLevel = 2
+                elseif distSqr > lodDist * lodDist then
+                    lodLevel = 1
+                end
             end
         end
-        if CONVARS.PVS_CULL:GetBool() then
+        if nativeVis then
+            local index = GetNativeChunkIndex(renderType, chunkMaterials)
+            if nativeVisible and index and nativeVisCache[renderType] and not nativeVisible[index] then
+                culledPVS = culledPVS + 1
+                continue
+            end
+        elseif CONVARS.PVS_CULL:GetBool() then
             local clusters = chunkMaterials._clusters
             if not IsChunkVisibleByPVS(viewCluster, clusters) then
                 culledPVS = culledPVS + 1
@@ -517,10 +940,15 @@ local function RenderCustomWorld(translucent)
             end
         end
         for key, group in pairs(chunkMaterials) do
-            if key == "_mins" or key == "_maxs" then continue end
+            if key == "_mins" or key == "_maxs" or key == "_visIndex" or key == "_cullId" then continue end
             if not group or not group.meshes then continue end
             -- Submit meshes to central render queue
             local meshes = group.meshes
+            local lods = group.lods
+            if lodLevel > 0 and lods and #lods > 0 then
+                meshes = lods[math_min(lodLevel, #lods)]
+                lodDraws = lodDraws + #meshes
+            end
             for i = 1, #meshes do
                 local m = meshes[i]
                 if m then
@@ -539,12 +967,14 @@ local function RenderCustomWorld(translucent)
     renderStats.chunksVisited = chunksVisited
     renderStats.culledFrustum = culledFrustum
     renderStats.culledPVS = culledPVS
+    renderStats.lodDraws = lodDraws
 end
 
 -- Stats provider for unified overlay
 RenderCore.RegisterStats("RTXWorld", function()
-    return string.format("World draws: %d | chunks: %d (-F:%d, -P:%d)",
+    return string.format("World draws: %d (LOD:%d) | chunks: %d (-F:%d, -P:%d)",
         renderStats.draws or 0,
+        renderStats.lodDraws or 0,
         renderStats.chunksVisited or 0,
         renderStats.culledFrustum or 0,
         renderStats.culledPVS or 0)
@@ -619,6 +1049,7 @@ RenderCore.Register("ShutDown", "RTXCustomWorldShutdown", function()
     DisableCustomRendering()
     -- Rely on RenderCore global cleanup for tracked meshes; just clear tables locally
     mapMeshes = { opaque = {}, translucent = {} }
+    ResetWorldCullIndex()
 end)
 
 -- ConVar Changes
@@ -650,6 +1081,9 @@ DebounceRebuildOnCvar("rtx_mwr_chunk_size")
 DebounceRebuildOnCvar("rtx_mwr_mat_whitelist")
 DebounceRebuildOnCvar("rtx_mwr_mat_blacklist")
 DebounceRebuildOnCvar("rtx_mwr_distance")
+DebounceRebuildOnCvar("rtx_mwr_lod")
+DebounceRebuildOnCvar("rtx_mwr_megabatch")
+DebounceRebuildOnCvar("rtx_mwr_megabatch_extent")
 
 -- Menu
 hook.Add("PopulateToolMenu", "RTXCustomWorldMenu", function()
@@ -23,6 +23,26 @@ local worldProps = {}
 local sprStats = { rendered = 0, total = 0 }
 local sprBuildStats = { startTime = 0, endTime = 0, built = 0 }
 local propBins = {}
+-- Native instance batches ({ world = {...}, skybox = {...} }); nil when the NikNaks path is in use
+local instanceBatches = nil
+-- Batches with visible instances in the current draw pass. Each batch keeps its own scratch
+-- lists (visibleMatrices/visibleColors) that are refilled in place, so a pass allocates nothing.
+local visibleBatches = {}
+local visibleBatchCount = 0
+local drawPass = 0
+
+local function AddVisibleInstance(batch, i)
+    if batch.visiblePass ~= drawPass then
+        batch.visiblePass = drawPass
+        batch.visibleCount = 0
+        visibleBatchCount = visibleBatchCount + 1
+        visibleBatches[visibleBatchCount] = batch
+    end
+    local n = batch.visibleCount + 1
+    batch.visibleCount = n
+    batch.visibleMatrices[n] = batch.matrices[i]
+    batch.visibleColors[n] = batch.colors and batch.colors[i] or nil
+end
 
 -- Debug helper function
 local DebugPrint = (RenderCore and RenderCore.CreateDebugPrint)
@@ -58,40 +78,9 @@ local function IsMaterialAllowedName(matName)
     return true
 end
 
--- Process a static prop and prepare rendering data
-local function ProcessStaticProp(propData)
-    local modelPath = propData.PropType
-    if not modelPath or modelPath == "" then
-        DebugPrint("Static prop has no model path")
-        return nil
-    end
-    
-    -- Create the prop data structure
-    local prop = {
-        model = modelPath,
-        origin = propData.Origin,
-        angles = propData.Angles,
-        skin = propData.Skin or 0,
-        color = propData.DiffuseModulation or Color(255, 255, 255)
-    }
-
-    -- Check if this is a skybox prop
-    local isSkyboxProp = false
-    if NikNaks and NikNaks.CurrentMap and NikNaks.CurrentMap:HasSkyBox() then
-        local skyPos = NikNaks.CurrentMap:GetSkyBoxPos()
-        local skyMinBounds, skyMaxBounds = NikNaks.CurrentMap:GetSkyboxSize()
-        
-        -- Check if the prop is within skybox bounds
-        if skyMinBounds and skyMaxBounds and propData.Origin then
-            isSkyboxProp = propData.Origin:WithinAABox(skyMinBounds, skyMaxBounds)
-        end
-    end
-    
-    -- Store this information in the prop data
-    prop.isSkybox = isSkyboxProp
-    
-    -- Check if we already cached this model's mesh
-    local cacheKey = modelPath .. "_skin" .. prop.skin
+-- Build (once) and return the mesh set of a model/skin pair; nil if the model has nothing drawable
+local function GetCachedModelMesh(modelPath, skin)
+    local cacheKey = modelPath .. "_skin" .. skin
     if not meshCache[cacheKey] then
         -- Get the mesh data
         local meshData = GetModelMeshes(modelPath)
@@ -122,19 +111,15 @@ local function ProcessStaticProp(propData)
                 -- Create or get cached material
                 local mat = GetCachedMaterial(material)
                 
-                -- Validate vertices for this group
-                local valid = true
-                if RenderCore and RenderCore.ValidateVertex then
-                    for _, vert in ipairs(group.triangles) do
-                        if not RenderCore.ValidateVertex(vert.pos) then
-                            valid = false
-                            break
-                        end
+                -- Validate and bound the group's vertices in one pass
+                local groupMins, groupMaxs
+                if RenderCore and RenderCore.ValidateVertices then
+                    local rejectedCount
+                    rejectedCount, groupMins, groupMaxs = RenderCore.ValidateVertices(group.triangles)
+                    if rejectedCount > 0 then
+                        continue
                     end
                 end
-                if not valid then
-                    continue
-                end
 
                 -- Create mesh for this group
                 local mesh = Mesh()
@@ -151,13 +136,18 @@ local function ProcessStaticProp(propData)
                 end
                 
                 -- Update bounds
-                for _, vert in ipairs(group.triangles) do
-                    if vert.pos.x < mins.x then mins.x = vert.pos.x end
-                    if vert.pos.y < mins.y then mins.y = vert.pos.y end
-                    if vert.pos.z < mins.z then mins.z = vert.pos.z end
-                    if vert.pos.x > maxs.x then maxs.x = vert.pos.x end
-                    if vert.pos.y > maxs.y then maxs.y = vert.pos.y end
-                    if vert.pos.z > maxs.z then maxs.z = vert.pos.z end
+                if groupMins then
+                    mins.x = math.min(mins.x, groupMins.x); mins.y = math.min(mins.y, groupMins.y); mins.z = math.min(mins.z, groupMins.z)
+                    maxs.x = math.max(maxs.x, groupMaxs.x); maxs.y = math.max(maxs.y, groupMaxs.y); maxs.z = math.max(maxs.z, groupMaxs.z)
+                else
+                    for _, vert in ipairs(group.triangles) do
+                        if vert.pos.x < mins.x then mins.x = vert.pos.x end
+                        if vert.pos.y < mins.y then mins.y = vert.pos.y end
+                        if vert.pos.z < mins.z then mins.z = vert.pos.z end
+                        if vert.pos.x > maxs.x then maxs.x = vert.pos.x end
+                        if vert.pos.y > maxs.y then maxs.y = vert.pos.y end
+                        if vert.pos.z > maxs.z then maxs.z = vert.pos.z end
+                    end
                 end
             end
         end
@@ -182,12 +172,166 @@ local function ProcessStaticProp(propData)
     elseif meshCache[cacheKey].error then
         return nil  -- Skip previously failed models
     end
+
+    return meshCache[cacheKey]
+end
+
+-- Process a static prop and prepare rendering data
+local function ProcessStaticProp(propData)
+    local modelPath = propData.PropType
+    if not modelPath or modelPath == "" then
+        DebugPrint("Static prop has no model path")
+        return nil
+    end
+    
+    -- Create the prop data structure
+    local prop = {
+        model = modelPath,
+        origin = propData.Origin,
+        angles = propData.Angles,
+        skin = propData.Skin or 0,
+        color = propData.DiffuseModulation or Color(255, 255, 255)
+    }
+
+    -- Check if this is a skybox prop
+    local isSkyboxProp = false
+    if NikNaks and NikNaks.CurrentMap and NikNaks.CurrentMap:HasSkyBox() then
+        local skyPos = NikNaks.CurrentMap:GetSkyBoxPos()
+        local skyMinBounds, skyMaxBounds = NikNaks.CurrentMap:GetSkyboxSize()
+        
+        -- Check if the prop is within skybox bounds
+        if skyMinBounds and skyMaxBounds and propData.Origin then
+            isSkyboxProp = propData.Origin:WithinAABox(skyMinBounds, skyMaxBounds)
+        end
+    end
+    
+    -- Store this information in the prop data
+    prop.isSkybox = isSkyboxProp
     
     -- Link to the cached mesh data
-    prop.cachedMesh = meshCache[cacheKey]
+    prop.cachedMesh = GetCachedModelMesh(modelPath, prop.skin)
+    if not prop.cachedMesh then return nil end
     return prop
 end
 
+-- Native path: the binary module reads the static prop lump and groups props per model, skin and
+-- bin with prebuilt transforms, so a frame binds each batch mesh's material once and draws its
+-- visible instances back to back. Every prop still costs one Lua-driven draw (model matrix push,
+-- mesh:Draw, pop); what goes away is building a Matrix and queue entry per prop each frame.
+-- Culling stays per instance.
+local function CacheNativeStaticProps()
+    if not istable(RemixBSP) or not RemixBSP.GetStaticPropBatches then return false end
+    if not (RenderCore.OpenNativeMap and RenderCore.OpenNativeMap()) then return false end
+
+    local batches = RemixBSP.GetStaticPropBatches(convar_BinSize:GetInt())
+    if not batches then return false end
+
+    isCachingInProgress = true
+    print("[Static Render] Starting native static prop batching...")
+    sprBuildStats.startTime = SysTime()
+    sprBuildStats.endTime = 0
+    sprBuildStats.built = 0
+
+    local built = { world = {}, skybox = {} }
+    local processed, skipped = 0, 0
+    local co = coroutine.create(function()
+        local startTime = SysTime()
+        for _, batch in ipairs(batches) do
+            local count = #batch.transforms
+            local meshData = GetCachedModelMesh(batch.model, batch.skin)
+            if meshData then
+                local matrices, origins = {}, {}
+                for i, rows in ipairs(batch.transforms) do
+                    matrices[i] = Matrix(rows)
+                    origins[i] = Vector(rows[1][4], rows[2][4], rows[3][4])
+                end
+                -- Pad the origin bounds by the model's local extent so culling stays conservative
+                local radius = math.max(meshData.mins:Length(), meshData.maxs:Length())
+                local pad = Vector(radius, radius, radius)
+                local entry = {
+                    matrices = matrices,
+                    origins = origins,
+                    colors = next(batch.colors) and batch.colors or nil,
+                    pad = pad,
+                    mins = batch.mins - pad,
+                    maxs = batch.maxs + pad,
+                    count = count,
+                    visibleMatrices = {},
+                    visibleColors = {},
+                    visibleCount = 0,
+                    visibleTrim = 0,
+                    visiblePass = 0,
+                    submits = {}
+                }
+                -- Queue entries are built once and point at the scratch lists
+                for _, meshInfo in ipairs(meshData.meshes) do
+                    if meshInfo.mesh and meshInfo.material then
+                        entry.submits[#entry.submits + 1] = {
+                            material = meshInfo.material,
+                            mesh = meshInfo.mesh,
+                            matrices = entry.visibleMatrices,
+                            colors = entry.visibleColors,
+                            translucent = false
+                        }
+                    end
+                end
+                table.insert(batch.skybox and built.skybox or built.world, entry)
+                processed = processed + count
+                sprBuildStats.built = sprBuildStats.built + count
+            else
+                skipped = skipped + count
+            end
+
+            if SysTime() - startTime > 0.003 then
+                coroutine.yield()
+                startTime = SysTime()
+            end
+        end
+
+        -- World props go into the native BVH one instance each, centred on the prop origin, so a
+        -- query applies the frustum and the per-prop origin distance. The skybox keeps its short list.
+        if istable(RemixCull) then
+            RemixCull.ClearIndex("staticprops")
+            local ids, mins, maxs = {}, {}, {}
+            local instanceBatch, instanceIndex = {}, {}
+            for _, batch in ipairs(built.world) do
+                for i, origin in ipairs(batch.origins) do
+                    local id = #ids + 1
+                    ids[id], mins[id], maxs[id] = id, origin - batch.pad, origin + batch.pad
+                    instanceBatch[id], instanceIndex[id] = batch, i
+                end
+            end
+            RemixCull.AddItems("staticprops", ids, mins, maxs)
+            built.instanceBatch = instanceBatch
+            built.instanceIndex = instanceIndex
+            built.cullIndexed = true
+        end
+
+        instanceBatches = built
+        isDataReady = true
+        isCachingInProgress = false
+        print(string.format("[Static Render] Native batching complete. %d static props in %d batches, %d skipped.",
+            processed, #built.world + #built.skybox, skipped))
+        sprStats.total = processed
+        sprBuildStats.endTime = SysTime()
+    end)
+
+    local function Step()
+        if coroutine.status(co) == "dead" then return end
+        local ok, err = coroutine.resume(co)
+        if not ok then
+            ErrorNoHalt("[Static Render] Native batch coroutine error: " .. tostring(err) .. "\n")
+            isCachingInProgress = false
+            return
+        end
+        if coroutine.status(co) ~= "dead" then
+            timer.Simple(0, Step)
+        end
+    end
+    Step()
+    return true
+end
+
 -- Separate skybox props from world props
 local function SeparateSkyboxProps()
     skyboxProps = {}
@@ -230,6 +374,8 @@ end
 -- Cache static props from NikNaks data
 local function CacheMapStaticProps()
     if isCachingInProgress then return end
+    instanceBatches = nil
+    if CacheNativeStaticProps() then return end
     
     DebugPrint("Checking NikNaks availability...")
     
@@ -357,6 +503,7 @@ RenderCore.Register("ShutDown", "CustomStaticRender_Cleanup", function()
     table.Empty(skyboxProps)
     table.Empty(worldProps)
     table.Empty(meshCache)
+    instanceBatches = nil
     
     isDataReady = false
     isCachingInProgress = false
@@ -368,6 +515,66 @@ RenderCore.Register("PreDrawOpaqueRenderables", "CustomStaticRender_DrawProps",
         return
     end
     
+    if instanceBatches then
+        local playerPos = LocalPlayer():GetPos()
+        local maxDistance = convar_RenderDistance:GetFloat()
+        local useDistanceLimit = maxDistance > 0 and not bDrawingSkybox
+        local maxDistSqr = maxDistance * maxDistance
+        local renderedProps, distanceSkipped = 0, 0
+        drawPass = drawPass + 1
+        visibleBatchCount = 0
+
+        if not bDrawingSkybox and instanceBatches.cullIndexed then
+            -- Frustum and origin distance per instance, both in the native BVH
+            local instanceBatch, instanceIndex = instanceBatches.instanceBatch, instanceBatches.instanceIndex
+            local ids = RemixCull.Query("staticprops", playerPos, useDistanceLimit and maxDistance or 0)
+            for k = 1, #ids do
+                local id = ids[k]
+                AddVisibleInstance(instanceBatch[id], instanceIndex[id])
+            end
+            -- The BVH doesn't say why an instance was dropped, so like the CullBox path nothing
+            -- is counted as skipped
+            renderedProps = #ids
+        else
+            local batches = bDrawingSkybox and instanceBatches.skybox or instanceBatches.world
+            local hasCullBox = not bDrawingSkybox and render and type(render.CullBox) == "function"
+            for b = 1, #batches do
+                local batch = batches[b]
+                if not (hasCullBox and render.CullBox(batch.mins, batch.maxs)) then
+                    local origins = batch.origins
+                    for i = 1, #origins do
+                        if useDistanceLimit and origins[i]:DistToSqr(playerPos) > maxDistSqr then
+                            distanceSkipped = distanceSkipped + 1
+                        else
+                            AddVisibleInstance(batch, i)
+                            renderedProps = renderedProps + 1
+                        end
+                    end
+                end
+            end
+        end
+
+        for b = 1, visibleBatchCount do
+            local batch = visibleBatches[b]
+            -- Cut what a longer earlier pass left behind so the lists end at visibleCount
+            local matrices, colors = batch.visibleMatrices, batch.visibleColors
+            for j = batch.visibleCount + 1, batch.visibleTrim do
+                matrices[j] = nil
+                colors[j] = nil
+            end
+            batch.visibleTrim = batch.visibleCount
+
+            local submits = batch.submits
+            for k = 1, #submits do
+                RenderCore.Submit(submits[k])
+            end
+        end
+        sprStats.rendered = renderedProps
+        sprStats.distance = distanceSkipped
+        sprStats.skipped = 0
+        return
+    end
+
     -- Choose which prop list to render based on skybox state
     local propsToRender = bDrawingSkybox and skyboxProps or worldProps
     
@@ -493,6 +700,7 @@ concommand.Add("rtx_spr_reload", function()
     table.Empty(skyboxProps)
     table.Empty(worldProps)
     table.Empty(meshCache)
+    instanceBatches = nil
     
     timer.Simple(0.1, CacheMapStaticProps)
 end)
@@ -522,6 +730,7 @@ RenderCore.RegisterRebuildSink("StaticPropsRebuild", function(token, reason)
     table.Empty(skyboxProps)
     table.Empty(worldProps)
     table.Empty(meshCache)
+    instanceBatches = nil
     timer.Simple(0.1, CacheMapStaticProps)
 end)
 
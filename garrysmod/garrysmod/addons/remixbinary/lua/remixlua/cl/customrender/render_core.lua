@@ -33,6 +33,14 @@ do
         queues.translucent = {}
         frameState.began = true
         frameState.skybox = bSkybox or false
+        -- Hand the current view to the native culler so RemixCull queries match this pass
+        if istable(RemixCull) then
+            local view = render.GetViewSetup()
+            if view then
+                local aspect = view.aspect or ((view.height or 0) > 0 and view.width / view.height) or (ScrW() / ScrH())
+                RemixCull.SetView(view.origin, view.angles, view.fov or 90, aspect)
+            end
+        end
         -- Advance scheduled jobs conservatively
         RemixRenderCore.StepJobs(0.0015)
     end
@@ -47,6 +55,8 @@ do
 
     function RemixRenderCore.Submit(item)
         -- item = { material=IMaterial, mesh=IMesh, matrix=Matrix|nil, translucent=bool|nil, color=Color|{r,g,b}|nil }
+        -- Batched items pass matrices={Matrix,...} (+ optional sparse colors={[i]=Color}) instead of matrix/color;
+        -- the mesh is still drawn once per matrix, but under a single material bind and queue entry.
         if not item or not item.material or not item.mesh then return end
         local q = item.translucent and queues.translucent or queues.opaque
         -- store normalized color for fast modulation
@@ -69,13 +79,27 @@ do
                 render.SetMaterial(it.material)
                 lastMat = it.material
             end
-            if it._ncolor then
-                render.SetColorModulation(it._ncolor.r, it._ncolor.g, it._ncolor.b)
+            local matrices = it.matrices
+            if matrices then
+                local colors = it.colors
+                local m = it.mesh
+                for j = 1, #matrices do
+                    local col = colors and colors[j]
+                    if col then render.SetColorModulation(col.r / 255, col.g / 255, col.b / 255) end
+                    cam.PushModelMatrix(matrices[j])
+                    m:Draw()
+                    cam.PopModelMatrix()
+                    if col then render.SetColorModulation(1, 1, 1) end
+                end
+            else
+                if it._ncolor then
+                    render.SetColorModulation(it._ncolor.r, it._ncolor.g, it._ncolor.b)
+                end
+                if it.matrix then cam.PushModelMatrix(it.matrix) end
+                it.mesh:Draw()
+                if it.matrix then cam.PopModelMatrix() end
+                if it._ncolor then render.SetColorModulation(1, 1, 1) end
             end
-            if it.matrix then cam.PushModelMatrix(it.matrix) end
-            it.mesh:Draw()
-            if it.matrix then cam.PopModelMatrix() end
-            if it._ncolor then render.SetColorModulation(1, 1, 1) end
         end
     end
 
@@ -176,8 +200,18 @@ do
         return list
     end
 
-    function RemixRenderCore.IsMaterialAllowed(matName, whitelist, blacklist)
-        if not matName then return false end
+    -- Verdicts are cached per list pair and material name, so faces and props sharing a material
+    -- cost one table lookup. Changing a cvar yields new list strings and therefore a fresh cache.
+    -- Misses go to the module's compiled matcher when it is loaded.
+    local verdictCache = RemixRenderCore._materialVerdicts or {}
+    local verdictListCount = RemixRenderCore._materialVerdictLists or 0
+    local MAX_VERDICT_LISTS = 16
+
+    local function ComputeMaterialAllowed(matName, whitelist, blacklist)
+        if istable(RemixWorld) and RemixWorld.IsMaterialAllowed then
+            return RemixWorld.IsMaterialAllowed(matName, whitelist, blacklist)
+        end
+
         local lname = string.lower(matName)
         
         -- Check blacklist first
@@ -195,6 +229,63 @@ do
         return false
     end
 
+    function RemixRenderCore.IsMaterialAllowed(matName, whitelist, blacklist)
+        if not matName then return false end
+        whitelist = whitelist or ""
+        blacklist = blacklist or ""
+
+        local byWhitelist = verdictCache[blacklist]
+        if not byWhitelist then
+            byWhitelist = {}
+            verdictCache[blacklist] = byWhitelist
+        end
+        local verdicts = byWhitelist[whitelist]
+        if not verdicts then
+            if verdictListCount >= MAX_VERDICT_LISTS then
+                table.Empty(verdictCache)
+                verdictListCount = 0
+                byWhitelist = {}
+                verdictCache[blacklist] = byWhitelist
+            end
+            verdicts = {}
+            byWhitelist[whitelist] = verdicts
+            verdictListCount = verdictListCount + 1
+            RemixRenderCore._materialVerdictLists = verdictListCount
+        end
+
+        local allowed = verdicts[matName]
+        if allowed == nil then
+            allowed = ComputeMaterialAllowed(matName, whitelist, blacklist)
+            verdicts[matName] = allowed
+        end
+        return allowed
+    end
+
+    -- Skybox materials (tools/toolsskybox, skybox/, sky_) are never drawn by the world renderers.
+    -- Accepts a material name or IMaterial; verdicts are cached per key.
+    local skyboxCache = RemixRenderCore._skyboxVerdicts or {}
+
+    function RemixRenderCore.IsSkyboxMaterial(material)
+        if not material then return false end
+        local isSky = skyboxCache[material]
+        if isSky ~= nil then return isSky end
+
+        local matName = isstring(material) and material or material:GetName()
+        if istable(RemixWorld) and RemixWorld.IsSkyboxMaterial then
+            isSky = RemixWorld.IsSkyboxMaterial(matName)
+        else
+            local lname = string.lower(matName)
+            isSky = string.find(lname, "tools/toolsskybox", 1, true) ~= nil or
+                    string.find(lname, "skybox/", 1, true) ~= nil or
+                    string.find(lname, "sky_", 1, true) ~= nil
+        end
+        skyboxCache[material] = isSky
+        return isSky
+    end
+
+    RemixRenderCore._materialVerdicts = verdictCache
+    RemixRenderCore._skyboxVerdicts = skyboxCache
+
     -- ============================
     -- Spatial Binning Utilities
     -- ============================
@@ -269,6 +360,33 @@ do
         return true
     end
 
+    -- Validates a whole vertex list ({ pos = Vector } tables or bare Vectors) and bounds it in
+    -- one pass. Returns rejectedCount, mins, maxs and, when something was rejected, a set of
+    -- rejected indices. mins/maxs cover the accepted vertices and stay at +/-math.huge if none.
+    function RemixRenderCore.ValidateVertices(vertices)
+        if istable(RemixWorld) and RemixWorld.ValidateVertices then
+            return RemixWorld.ValidateVertices(vertices)
+        end
+
+        local bounds = {
+            mins = Vector(math.huge, math.huge, math.huge),
+            maxs = Vector(-math.huge, -math.huge, -math.huge)
+        }
+        local rejectedCount, rejected = 0, nil
+        for i = 1, #vertices do
+            local vert = vertices[i]
+            local pos = isvector(vert) and vert or (istable(vert) and vert.pos)
+            if RemixRenderCore.ValidateVertex(pos) then
+                RemixRenderCore.UpdateBounds(bounds, pos)
+            else
+                rejectedCount = rejectedCount + 1
+                rejected = rejected or {}
+                rejected[i] = true
+            end
+        end
+        return rejectedCount, bounds.mins, bounds.maxs, rejected
+    end
+
     -- ============================
     -- Debug Utilities
     -- ============================
@@ -300,6 +418,104 @@ do
         return mat
     end
 
+    -- ============================
+    -- Native BSP Access
+    -- ============================
+    -- Opens the current map in the binary module's mapped BSP reader, once per map.
+    -- Maps that only exist inside a GMA/VPK are handed over through file.Read instead.
+    function RemixRenderCore.OpenNativeMap()
+        if not istable(RemixBSP) then return false end
+        local mapName = game.GetMap()
+        if RemixRenderCore._nativeMap == mapName and RemixBSP.IsOpen() then return true end
+
+        local path = "maps/" .. mapName .. ".bsp"
+        local ok = RemixBSP.Open(path)
+        if not ok then
+            local data = file.Read(path, "GAME")
+            ok = data and RemixBSP.OpenFromString(data, path) or false
+        end
+
+        RemixRenderCore._nativeMap = ok and mapName or nil
+
+        -- Portal file written by vbsp next to the map, for portal-flow culling
+        if ok and RemixBSP.LoadPortals then
+            local portals = file.Read("maps/" .. mapName .. ".prt", "GAME")
+            if portals then
+                local loaded, err = RemixBSP.LoadPortals(portals)
+                if not loaded then
+                    print("[RemixRenderCore] Ignoring " .. mapName .. ".prt: " .. tostring(err))
+                end
+            end
+        end
+        return ok
+    end
+
+    -- Built world/displacement geometry is cached per map under data/remixworld/ and reused
+    -- while the map's geometry lumps and the renderer settings are unchanged
+    local geometryCacheConVar = CreateClientConVar("rtx_geometry_cache", "1", true, false, "Cache natively built world geometry on disk")
+
+    function RemixRenderCore.UseGeometryCache()
+        return geometryCacheConVar:GetBool()
+    end
+
+    -- Runs a native geometry build ("world" or "displacements") on the module's worker threads and
+    -- polls it once per frame; onDone(summary) runs on the game thread when it finishes. A
+    -- cancelled token cancels the native job. Modules without background builds block instead.
+    -- Returns false when the build could not be started so callers can fall back.
+    local nativeBuilds = RemixRenderCore._nativeBuilds or {}
+    RemixRenderCore._nativeBuilds = nativeBuilds
+
+    function RemixRenderCore.RunNativeBuild(kind, settings, cancelToken, onDone)
+        local start = kind == "world" and RemixWorld.StartWorldBuild or RemixWorld.StartDisplacementBuild
+        if not start then
+            local result = (kind == "world" and RemixWorld.BuildWorldChunks or RemixWorld.BuildDisplacements)(settings)
+            if not result then return false end
+            onDone(result)
+            return true
+        end
+
+        local job = start(settings)
+        if not job then return false end
+
+        local timerName = "RemixNativeBuild-" .. kind
+        local build = { job = job, progress = 0 }
+        nativeBuilds[kind] = build
+        timer.Create(timerName, 0, 0, function()
+            if cancelToken and cancelToken.cancelled then
+                RemixWorld.CancelBuild(job)
+                nativeBuilds[kind] = nil
+                timer.Remove(timerName)
+                return
+            end
+
+            local state, progress, result = RemixWorld.PollBuild(job)
+            if state == "running" then
+                build.progress = progress
+                return
+            end
+
+            nativeBuilds[kind] = nil
+            timer.Remove(timerName)
+            if state == "done" then
+                safeCall(timerName, onDone, result)
+            elseif state == "failed" then
+                ErrorNoHalt("[RemixRenderCore] Native " .. kind .. " build failed: " .. tostring(result) .. "\n")
+            end
+        end)
+        return true
+    end
+
+    function RemixRenderCore.GetNativeBuildProgress(kind)
+        local build = nativeBuilds[kind]
+        return build and build.progress or nil
+    end
+
+    concommand.Add("rtx_geometry_cache_clear", function()
+        if istable(RemixWorld) and RemixWorld.ClearGeometryCache then
+            print("[RemixRenderCore] Removed " .. RemixWorld.ClearGeometryCache() .. " geometry cache files")
+        end
+    end)
+
     -- ============================
     -- Lightweight Job Scheduler
     -- ============================
@@ -402,6 +618,15 @@ do
         statsFns[id] = nil
     end
 
+    RemixRenderCore.RegisterStats("NativeBuilds", function()
+        local parts = {}
+        for kind, build in pairs(nativeBuilds) do
+            parts[#parts + 1] = string.format("%s %d%%", kind, math.floor(build.progress * 100))
+        end
+        if #parts == 0 then return nil end
+        return "Native builds: " .. table.concat(parts, ", ")
+    end)
+
     local debugConVar = CreateClientConVar("rtx_render_debug", "0", true, false, "Show Remix render debug overlay")
     hook.Add("HUDPaint", "RemixRenderCoreDebug", function()
         if not debugConVar:GetBool() then return end
@@ -446,10 +671,15 @@ do
             panel:NumSlider("World Chunk Size", "rtx_mwr_chunk_size", 4096, 65536, 0)
             panel:NumSlider("World Distance (0=off)", "rtx_mwr_distance", 0, 524288, 0)
             panel:CheckBox("World PVS Culling", "rtx_mwr_pvs_cull")
+            panel:CheckBox("World Portal Culling", "rtx_mwr_portal_cull")
+            panel:CheckBox("World Distance LODs", "rtx_mwr_lod")
+            panel:NumSlider("World LOD Distance", "rtx_mwr_lod_distance", 512, 65536, 0)
             panel:TextEntry("World Material Whitelist", "rtx_mwr_mat_whitelist")
             panel:TextEntry("World Material Blacklist", "rtx_mwr_mat_blacklist")
             panel:NumSlider("Static Props Bin Size", "rtx_spr_bin_size", 1024, 65536, 0)
             panel:NumSlider("Displacements Bin Size", "rtx_cdr_bin_size", 1024, 65536, 0)
+            panel:CheckBox("Cache Built Geometry", "rtx_geometry_cache")
+            panel:Button("Clear Geometry Cache", "rtx_geometry_cache_clear")
 
             panel:Help("")
             panel:CheckBox("Displacements Enable", "rtx_cdr_enable")
@@ -486,6 +716,12 @@ do
         RemixRenderCore.DestroyTrackedMeshes()
         for k in pairs(matCache) do matCache[k] = nil end
         for k in pairs(statsFns) do statsFns[k] = nil end
+        for kind, build in pairs(nativeBuilds) do
+            RemixWorld.CancelBuild(build.job)
+            timer.Remove("RemixNativeBuild-" .. kind)
+            nativeBuilds[kind] = nil
+        end
+        if istable(RemixBSP) then RemixBSP.Close() end
     end)
 end
 
@@ -9,6 +9,7 @@ local creation_batch_size = CreateClientConVar("rtx_api_map_lights_batch_size",
 local creation_batch_delay = CreateClientConVar("rtx_api_map_lights_batch_delay", "0.0", true, false, "Delay between batches in seconds")
 local pos_jitter = CreateClientConVar("rtx_api_map_lights_position_jitter", "1", true, false, "Add a small random offset to light positions to prevent conflicts")
 local pos_jitter_amount = CreateClientConVar("rtx_api_map_lights_position_jitter_amount", "0.1", true, false, "Amount of random position offset")
+local convert_environment = CreateClientConVar("rtx_api_map_lights_environment", "0", true, false, "Also convert light_environment entities (native converter only)")
 local rect_rotation_x = CreateClientConVar("rtx_api_map_lights_rect_rotation_x", "0", true, false, "X rotation offset for rectangle and disk lights")
 local rect_rotation_y = CreateClientConVar("rtx_api_map_lights_rect_rotation_y", "0", true, false, "Y rotation offset for rectangle and disk lights")
 local rect_rotation_z = CreateClientConVar("rtx_api_map_lights_rect_rotation_z", "0", true, false, "Z rotation offset for rectangle and disk lights")
@@ -188,8 +189,64 @@ local function getLightProperties(entity)
     return color, brightness, size, lightType, lightProps
 end
 
+-- Native converter settings, mirroring the convars used by getLightProperties
+local function getNativeLightSettings(withJitter)
+    return {
+        brightness = brightness_multiplier:GetFloat(),
+        size = size_multiplier:GetFloat(),
+        minSize = min_size:GetFloat(),
+        maxSize = max_size:GetFloat(),
+        jitter = (withJitter and pos_jitter:GetBool()) and pos_jitter_amount:GetFloat() or 0,
+        environment = convert_environment:GetBool(),
+        rotationX = rect_rotation_x:GetFloat(),
+        rotationY = rect_rotation_y:GetFloat(),
+        rotationZ = rect_rotation_z:GetFloat(),
+        basis = spot_dir_basis:GetInt(),
+    }
+end
+
+local function openNativeMap()
+    if not istable(RemixBSP) then return false end
+    if istable(RemixRenderCore) and RemixRenderCore.OpenNativeMap then
+        return RemixRenderCore.OpenNativeMap()
+    end
+    return RemixBSP.IsOpen()
+end
+
+-- Native path: the binary module tokenizes the entity lump and converts the lights
+local function findLightsNative()
+    if not (istable(RemixBSP) and RemixBSP.GetMapLights and openNativeMap()) then return nil end
+
+    local nativeLights = RemixBSP.GetMapLights(getNativeLightSettings(false))
+    if not nativeLights then return nil end
+
+    local lights = {}
+    for _, l in ipairs(nativeLights) do
+        table.insert(lights, {
+            pos = l.pos,
+            color = Color(l.color.r, l.color.g, l.color.b),
+            brightness = l.brightness,
+            size = l.size,
+            classname = l.classname,
+            lightType = rtxLightTypes[l.classname] or 0,
+            lightProps = {
+                coneAngle = l.cone,
+                coneSoftness = l.softness,
+                shapingEnabled = l.shaped,
+                direction = l.shaped and l.direction or nil,
+                angles = l.angles,
+            },
+            angles = l.angles,
+        })
+    end
+    return lights
+end
+
 -- Find lights in the BSP data
 local function findLightsInBSP()
+    local nativeLights = findLightsNative()
+    if nativeLights then return nativeLights end
+
     if not NikNaks or not NikNaks.CurrentMap then 
         print("[Light2RTX] NikNaks or current map data not available!")
         return {} 
@@ -411,11 +468,51 @@ local function addPositionOffset(pos)
     return pos + offset
 end
 
+-- Native one-pass creation: the module converts every map light and creates them through its
+-- LightManager in a single call, so no per-light tables cross into Lua and no batching is needed
+local function createLightsNative()
+    if not (istable(RemixBSP) and RemixBSP.CreateMapLights and openNativeMap()) then return false end
+
+    local firstEntityId = getUniqueEntityID()
+    local created = RemixBSP.CreateMapLights(getNativeLightSettings(true), firstEntityId)
+    if not created then return false end
+
+    for _, l in ipairs(created) do
+        local color = Color(l.color.r, l.color.g, l.color.b)
+        createdLightPositions[string.format("%.1f_%.1f_%.1f", l.pos.x, l.pos.y, l.pos.z)] = true
+
+        local visualProp = nil
+        if visual_mode:GetBool() then
+            visualProp = createVisualProp(l.pos, color, l.classname)
+            if l.angles and IsValid(visualProp) then
+                visualProp:SetAngles(l.angles)
+            end
+        end
+
+        table.insert(createdLights, {
+            id = l.id,
+            entityId = l.entityId,
+            type = "sphere",
+            pos = l.pos,
+            color = color,
+            size = l.size,
+            shapingEnabled = l.shaped,
+            classname = l.classname,
+            visualProp = visualProp,
+        })
+    end
+
+    print("[Light2RTX] Natively created " .. #created .. " lights from the BSP entity lump")
+    return true
+end
+
 -- Create RTX lights for all the lights we found
 local function batchCreateRTXLights()
     -- Reset entity ID counter and position tracking
     last_entity_id = 0
     table.Empty(createdLightPositions)
+
+    if createLightsNative() then return end
     
     -- Get lights from BSP
     local bspLights = findLightsInBSP()
@@ -91,6 +91,14 @@ local function GetConfigPath(mapName)
     return CONFIG_DIR .. "/" .. mapName .. ".txt"
 end
 
+-- Start reading this map's config natively while the loading screen is up, so it's parsed by InitPostEntity
+if AUTO_LOAD:GetBool() and RemixConfig and RemixConfig.PrefetchMapConfig then
+    local mapName = GetCurrentMap()
+    if mapName ~= "" then
+        RemixConfig.PrefetchMapConfig(mapName)
+    end
+end
+
 -- File I/O helper function
 local function EnsureConfigDir()
     if not file.Exists(CONFIG_DIR, "DATA") then
@@ -106,7 +114,7 @@ local function SaveMapConfig(mapName)
     -- Reload tracked parameters from default.txt
     LoadTrackedParameters()
     
-    -- GetConfigVariable now reads directly from config file and defaults
+    -- GetConfigVariable reads from the cached rtx.conf mirror
     DebugPrint("Getting current config values...")
     
     local configData = {}
@@ -124,6 +132,8 @@ local function SaveMapConfig(mapName)
     
     -- Save RTX tracked config variables
     if RemixConfig and #TRACKED_CONFIGS > 0 then
+        -- Reads come from the module's rtx.conf mirror; pick up settings Remix just wrote
+        if RemixConfig.ReloadConfigFile then RemixConfig.ReloadConfigFile() end
         table.insert(configLines, "# RTX Remix Settings")
         for _, configKey in ipairs(TRACKED_CONFIGS) do
             local value = RemixConfig.GetConfigVariable(configKey)
@@ -190,6 +200,22 @@ local function LoadConfigFromFile(filePath, configName)
     
     DebugPrint("Loading config: " .. configName)
     
+    -- The native store takes the RTX options as one map layer and only pushes the ones that change
+    local useMapLayer = RemixConfig and RemixConfig.ApplyMapConfig ~= nil
+    local rtxValues = {}
+    
+    local function SetRTX(rtxKey, value, label)
+        if useMapLayer then
+            rtxValues[rtxKey] = value
+        elseif RemixConfig and RemixConfig.SetConfigVariable(rtxKey, value) then
+            DebugPrint("Loaded " .. label .. rtxKey .. " = " .. value)
+            return true
+        else
+            DebugPrint("Failed to set " .. label .. rtxKey .. " = " .. value)
+        end
+        return false
+    end
+    
     -- Parse config file and apply settings
     local loadedCount = 0
     for line in string.gmatch(configText, "[^\r\n]+") do
@@ -207,11 +233,8 @@ local function LoadConfigFromFile(filePath, configName)
                 -- Handle RTX config variables
                 if string.StartWith(key, "rtx:") then
                     local rtxKey = string.sub(key, 5) -- Remove "rtx:" prefix
-                    if RemixConfig and RemixConfig.SetConfigVariable(rtxKey, value) then
-                        DebugPrint("Loaded RTX " .. rtxKey .. " = " .. value)
+                    if SetRTX(rtxKey, value, "RTX ") then
                         loadedCount = loadedCount + 1
-                    else
-                        DebugPrint("Failed to set RTX " .. rtxKey .. " = " .. value)
                     end
                 -- Handle Source engine commands
                 elseif string.StartWith(key, "src:") then
@@ -221,24 +244,55 @@ local function LoadConfigFromFile(filePath, configName)
                     loadedCount = loadedCount + 1
                 -- Handle legacy format (backwards compatibility)
                 else
-                    if RemixConfig and RemixConfig.SetConfigVariable(key, value) then
-                        DebugPrint("Loaded (legacy) " .. key .. " = " .. value)
+                    if SetRTX(key, value, "(legacy) ") then
                         loadedCount = loadedCount + 1
-                    else
-                        DebugPrint("Failed to set (legacy) " .. key .. " = " .. value)
                     end
                 end
             end
         end
     end
     
+    if useMapLayer then
+        local applied, unchanged, failed = RemixConfig.ApplyMapConfig(rtxValues)
+        DebugPrint("RTX map layer: " .. applied .. " applied, " .. unchanged .. " already current, " .. failed .. " failed")
+        loadedCount = loadedCount + applied + unchanged
+    end
+    
     return true, loadedCount
 end
 
+-- Native loader: the module reads and parses the file (falling back to default.txt) and applies
+-- the RTX options as one map layer; Source cvars come back in file order for RunConsoleCommand
+local function LoadMapConfigNative(mapName)
+    local result = RemixConfig.LoadMapConfig(mapName)
+    if not result then
+        DebugPrint("No config file found for map: " .. mapName .. " (tried map-specific and default.txt)")
+        return false, 0
+    end
+    
+    for _, entry in ipairs(result.source) do
+        RunConsoleCommand(entry[1], entry[2])
+        DebugPrint("Loaded Source " .. entry[1] .. " = " .. entry[2])
+    end
+    
+    DebugPrint("RTX map layer: " .. result.applied .. " applied, " .. result.unchanged .. " already current, " .. result.failed .. " failed")
+    local loadedCount = result.applied + result.unchanged + #result.source
+    local configSource = string.GetFileFromFilename(result.path) == "default.txt" and "default config" or "map-specific config"
+    return true, loadedCount, configSource
+end
+
 local function LoadMapConfig(mapName)
     -- Reload tracked parameters from default.txt
     LoadTrackedParameters()
     
+    if RemixConfig and RemixConfig.LoadMapConfig then
+        local success, loadedCount, configSource = LoadMapConfigNative(mapName)
+        if success then
+            print("[gmRTX - Remix API] Loaded " .. loadedCount .. " RTX and Source settings from " .. configSource .. " for map: " .. mapName)
+        end
+        return success
+    end
+    
     local filePath = GetConfigPath(mapName)
     local defaultPath = CONFIG_DIR .. "/default.txt"
     local loadedCount = 0
@@ -428,6 +482,8 @@ concommand.Add("rtx_conf_default_save", function()
     
     -- Save RTX tracked config variables
     if RemixConfig and #TRACKED_CONFIGS > 0 then
+        -- Reads come from the module's rtx.conf mirror; pick up settings Remix just wrote
+        if RemixConfig.ReloadConfigFile then RemixConfig.ReloadConfigFile() end
         table.insert(configLines, "# RTX Remix Settings")
         for _, configKey in ipairs(TRACKED_CONFIGS) do
             local value = RemixConfig.GetConfigVariable(configKey)
@@ -471,7 +527,12 @@ concommand.Add("rtx_conf_load_default", function()
         return
     end
     
-    local success, count = LoadConfigFromFile(defaultPath, "default config")
+    local success, count
+    if RemixConfig and RemixConfig.LoadMapConfig then
+        success, count = LoadMapConfigNative("default")
+    else
+        success, count = LoadConfigFromFile(defaultPath, "default config")
+    end
     if success then
         print("[gmRTX - Remix API] Loaded " .. count .. " RTX and Source settings from default config")
     else
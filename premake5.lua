@@ -39,6 +39,7 @@ CreateWorkspace({name = "RTXFixesBinary", abi_compatible = false, path = ""})
 		files {
 			"source/remixapi/*",
 			"source/remixapi/rtxlights/*",
+			"source/worldapi/*",
 		} 
 
 
@@ -46,4 +47,39 @@ CreateWorkspace({name = "RTXFixesBinary", abi_compatible = false, path = ""})
 			files({"source/win32/*.cpp", "source/win32/*.hpp"})
 
 		filter("system:linux or macosx")
-			files({"source/posix/*.cpp", "source/posix/*.hpp"})
\ No newline at end of file
+			files({"source/posix/*.cpp", "source/posix/*.hpp"})
+
+	filter({})
+
+	-- rtxconf: merge/filter/diff/dedupe texture lists of rtx.conf files from the command line,
+	-- using the same parser and texture list code as the module
+	project("rtxconf")
+		kind("ConsoleApp")
+		language("C++")
+		cppdialect("C++17")
+
+		includedirs {
+			"source",
+		}
+
+		files {
+			"source/tools/rtxconf.cpp",
+			"source/remixapi/texture_lists.cpp",
+			"source/worldapi/mapped_file.cpp",
+		}
+
+	-- mesh_simplifier_test: checks the LOD simplifier reaches its target triangle counts;
+	-- exits non-zero on failure
+	project("mesh_simplifier_test")
+		kind("ConsoleApp")
+		language("C++")
+		cppdialect("C++17")
+
+		includedirs {
+			"source",
+		}
+
+		files {
+			"source/tests/mesh_simplifier_test.cpp",
+			"source/worldapi/mesh_simplifier.cpp",
+		}
@@ -22,6 +22,8 @@
 #include "remixapi/remixapi.h"
 #endif // _WIN64
 
+#include "worldapi/worldapi.h"
+
 #ifdef GMOD_MAIN
 extern IMaterialSystem* materials = NULL;
 #endif
@@ -33,11 +35,19 @@ IDirect3DDevice9Ex* g_d3dDevice = nullptr;
 
 // Remix API present auto-instancing callback
 typedef remixapi_ErrorCode (REMIXAPI_CALL* PFN_remixapi_AutoInstancePersistentLights)(void);
+typedef remixapi_ErrorCode (REMIXAPI_CALL* PFN_remixapi_RegisterCallbacks)(
+    PFN_remixapi_BridgeCallback,
+    PFN_remixapi_BridgeCallback,
+    PFN_remixapi_BridgeCallback);
 static PFN_remixapi_AutoInstancePersistentLights g_pfnAutoInstancePersistentLights = nullptr;
+// Kept so the callbacks can be unregistered before the module unloads
+static PFN_remixapi_RegisterCallbacks g_pfnRegisterCallbacks = nullptr;
 static void __stdcall RemixPresentCallback() {
     if (g_pfnAutoInstancePersistentLights) {
         g_pfnAutoInstancePersistentLights();
     }
+    // Config transactions committed since the last frame
+    RemixAPI::RemixAPI::Instance().OnPresentCallback();
 }
 #endif
 
@@ -78,10 +88,6 @@ GMOD_MODULE_OPEN() {
 
         // Register native Remix API frame callbacks to submit lights (resolve dynamically)
         {
-            typedef remixapi_ErrorCode (REMIXAPI_CALL* PFN_remixapi_RegisterCallbacks)(
-                PFN_remixapi_BridgeCallback,
-                PFN_remixapi_BridgeCallback,
-                PFN_remixapi_BridgeCallback);
             HMODULE hRemix = nullptr;
             if (g_remix && g_remix->m_RemixDLL) {
                 hRemix = g_remix->m_RemixDLL;
@@ -93,12 +99,13 @@ GMOD_MODULE_OPEN() {
                 // Resolve optional auto-instancing helper
                 g_pfnAutoInstancePersistentLights = reinterpret_cast<PFN_remixapi_AutoInstancePersistentLights>(
                     GetProcAddress(hRemix, "remixapi_AutoInstancePersistentLights"));
-                auto pfnRegister = reinterpret_cast<PFN_remixapi_RegisterCallbacks>(
+                g_pfnRegisterCallbacks = reinterpret_cast<PFN_remixapi_RegisterCallbacks>(
                     GetProcAddress(hRemix, "remixapi_RegisterCallbacks"));
-                if (pfnRegister) {
+                if (g_pfnRegisterCallbacks) {
                     // Use present callback to auto-instance all persistent external API lights each frame
-                    PFN_remixapi_BridgeCallback presentCb = g_pfnAutoInstancePersistentLights ? &RemixPresentCallback : nullptr;
-                    pfnRegister(nullptr, nullptr, presentCb);
+                    // and to apply committed config transactions at a frame boundary
+                    g_pfnRegisterCallbacks(nullptr, nullptr, &RemixPresentCallback);
+                    RemixAPI::RemixAPI::Instance().GetConfigManager().SetPresentCallbackActive(true);
                 } else {
                     Msg("[gmRTX - Binary Module] remixapi_RegisterCallbacks not found in d3d9.dll, skipping callback registration.\n");
                 }
@@ -114,6 +121,11 @@ GMOD_MODULE_OPEN() {
 
         #endif // _WIN64
 
+        // World geometry helpers have no Remix dependency and load on every architecture
+        if (!WorldAPI::WorldAPI::Instance().Initialize(LUA)) {
+            Warning("[gmRTX - Binary Module] Failed to initialize WorldAPI\n");
+        }
+
         // Register Lua functions
         LUA->PushSpecial(GarrysMod::Lua::SPECIAL_GLOB); 
 
@@ -132,7 +144,15 @@ GMOD_MODULE_CLOSE() {
     try {
         Msg("[gmRTX - Binary Module] Shutting down module...\n");
 
+        WorldAPI::WorldAPI::Instance().Shutdown();
+
 #ifdef _WIN64
+        // Remix must stop calling into this DLL before the managers go away
+        if (g_pfnRegisterCallbacks) {
+            g_pfnRegisterCallbacks(nullptr, nullptr, nullptr);
+            g_pfnRegisterCallbacks = nullptr;
+        }
+
         RemixAPI::RemixAPI::Instance().Shutdown();
         g_d3dDevice = nullptr;
 
@@ -6,7 +6,62 @@ using namespace GarrysMod::Lua;
 
 namespace RemixAPI {
 
+// Reads a Lua string, number or bool at index as a config value. Numbers and bools stay
+// typed so nothing is formatted unless the option turns out to be a string.
+static bool ReadConfigValue(ILuaBase* LUA, int index, ConfigValue& out) {
+    switch (LUA->GetType(index)) {
+        case Type::String:
+            out = ConfigValue::String(LUA->GetString(index));
+            return true;
+        case Type::Number:
+            out = ConfigValue::Float(LUA->GetNumber(index));
+            return true;
+        case Type::Bool:
+            out = ConfigValue::Bool(LUA->GetBool(index));
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Pushes a config value as a bool, number, { x, y, z } array or string
+static void PushConfigValue(ILuaBase* LUA, const ConfigValue& value) {
+    switch (value.type) {
+        case RtxOptionType::Bool:
+            LUA->PushBool(value.data.b);
+            break;
+        case RtxOptionType::Int:
+        case RtxOptionType::Float:
+            LUA->PushNumber(value.Component(0));
+            break;
+        case RtxOptionType::Vector:
+            LUA->CreateTable();
+            for (uint8_t i = 0; i < value.count; ++i) {
+                LUA->PushNumber(static_cast<double>(i + 1));
+                LUA->PushNumber(value.data.v[i]);
+                LUA->SetTable(-3);
+            }
+            break;
+        default:
+            LUA->PushString(value.text.c_str());
+            break;
+    }
+}
+
+// Reads { [key] = value } from the table at index; entries with other key or value types are ignored
+static void ReadConfigTable(ILuaBase* LUA, int index, std::vector<std::pair<std::string, ConfigValue>>& out) {
+    LUA->PushNil();
+    while (LUA->Next(index) != 0) {
+        ConfigValue value;
+        if (LUA->IsType(-2, Type::String) && ReadConfigValue(LUA, -1, value)) {
+            out.emplace_back(LUA->GetString(-2), std::move(value));
+        }
+        LUA->Pop();
+    }
+}
+
 // Lua function: RemixConfig.SetConfigVariable(key, value)
+// value may be a string, number or bool; it is parsed as the option's type and clamped.
 LUA_FUNCTION(RemixConfig_SetConfigVariable) {
     if (!LUA->IsType(1, Type::String)) {
         Warning("[RemixConfig] SetConfigVariable: Expected string for config key, got %s\n", LUA->GetTypeName(LUA->GetType(1)));
@@ -14,17 +69,17 @@ LUA_FUNCTION(RemixConfig_SetConfigVariable) {
         return 1;
     }
     
-    if (!LUA->IsType(2, Type::String)) {
-        Warning("[RemixConfig] SetConfigVariable: Expected string for config value, got %s\n", LUA->GetTypeName(LUA->GetType(2)));
+    ConfigValue value;
+    if (!ReadConfigValue(LUA, 2, value)) {
+        Warning("[RemixConfig] SetConfigVariable: Expected string, number or boolean for config value, got %s\n", LUA->GetTypeName(LUA->GetType(2)));
         LUA->PushBool(false);
         return 1;
     }
     
     std::string key = LUA->GetString(1);
-    std::string value = LUA->GetString(2);
     
     auto& configManager = RemixAPI::Instance().GetConfigManager();
-    bool result = configManager.SetConfigVariable(key, value);
+    bool result = configManager.SetConfigValue(key, std::move(value));
     
     LUA->PushBool(result);
     return 1;
@@ -47,6 +102,262 @@ LUA_FUNCTION(RemixConfig_GetConfigVariable) {
     return 1;
 }
 
+// Lua function: RemixConfig.GetConfigValue(key) -> bool | number | { x, y, z } | string | nil
+// Typed counterpart of GetConfigVariable.
+LUA_FUNCTION(RemixConfig_GetConfigValue) {
+    if (!LUA->IsType(1, Type::String)) {
+        Warning("[RemixConfig] GetConfigValue: Expected string for config key, got %s\n", LUA->GetTypeName(LUA->GetType(1)));
+        LUA->PushNil();
+        return 1;
+    }
+    
+    auto& configManager = RemixAPI::Instance().GetConfigManager();
+    const ConfigValue* value = configManager.GetConfigValue(LUA->GetString(1));
+    if (!value) {
+        LUA->PushNil();
+        return 1;
+    }
+    
+    PushConfigValue(LUA, *value);
+    return 1;
+}
+
+// Lua function: RemixConfig.SetMany({ [key] = value }) -> applied, skipped, failed
+// Sets are normalised, sorted by key and dropped when they match the known current value.
+LUA_FUNCTION(RemixConfig_SetMany) {
+    if (!LUA->IsType(1, Type::Table)) {
+        Warning("[RemixConfig] SetMany: Expected table of config values, got %s\n", LUA->GetTypeName(LUA->GetType(1)));
+        LUA->PushNumber(0);
+        LUA->PushNumber(0);
+        LUA->PushNumber(0);
+        return 3;
+    }
+    
+    std::vector<std::pair<std::string, ConfigValue>> values;
+    ReadConfigTable(LUA, 1, values);
+    
+    auto& configManager = RemixAPI::Instance().GetConfigManager();
+    const auto result = configManager.SetConfigVariables(values);
+    
+    LUA->PushNumber(static_cast<double>(result.applied));
+    LUA->PushNumber(static_cast<double>(result.skipped));
+    LUA->PushNumber(static_cast<double>(result.failed));
+    return 3;
+}
+
+// Lua function: RemixConfig.GetConfigLayer(key) -> "runtime" | "map" | "file" | "default" | nil
+LUA_FUNCTION(RemixConfig_GetConfigLayer) {
+    if (!LUA->IsType(1, Type::String)) {
+        Warning("[RemixConfig] GetConfigLayer: Expected string for config key, got %s\n", LUA->GetTypeName(LUA->GetType(1)));
+        LUA->PushNil();
+        return 1;
+    }
+    
+    auto& configManager = RemixAPI::Instance().GetConfigManager();
+    switch (configManager.GetConfigLayer(LUA->GetString(1))) {
+        case ConfigLayer::Runtime: LUA->PushString("runtime"); break;
+        case ConfigLayer::Map: LUA->PushString("map"); break;
+        case ConfigLayer::File: LUA->PushString("file"); break;
+        case ConfigLayer::Default: LUA->PushString("default"); break;
+        default: LUA->PushNil(); break;
+    }
+    return 1;
+}
+
+// Lua function: RemixConfig.ApplyMapConfig({ [key] = value }) -> applied, unchanged, failed
+// Replaces the map layer; only options whose value actually changes reach Remix.
+LUA_FUNCTION(RemixConfig_ApplyMapConfig) {
+    if (!LUA->IsType(1, Type::Table)) {
+        Warning("[RemixConfig] ApplyMapConfig: Expected table of config values, got %s\n", LUA->GetTypeName(LUA->GetType(1)));
+        LUA->PushNumber(0);
+        LUA->PushNumber(0);
+        LUA->PushNumber(0);
+        return 3;
+    }
+    
+    std::vector<std::pair<std::string, ConfigValue>> values;
+    ReadConfigTable(LUA, 1, values);
+    
+    auto& configManager = RemixAPI::Instance().GetConfigManager();
+    const auto result = configManager.ApplyMapConfig(values);
+    
+    LUA->PushNumber(static_cast<double>(result.applied));
+    LUA->PushNumber(static_cast<double>(result.unchanged));
+    LUA->PushNumber(static_cast<double>(result.failed));
+    return 3;
+}
+
+// Lua function: RemixConfig.ReloadConfigFile()
+LUA_FUNCTION(RemixConfig_ReloadConfigFile) {
+    auto& configManager = RemixAPI::Instance().GetConfigManager();
+    LUA->PushBool(configManager.ReloadConfigFile());
+    return 1;
+}
+
+// Lua function: RemixConfig.PrefetchMapConfig(mapName)
+// Starts reading the map's config (or default.txt) in the background
+LUA_FUNCTION(RemixConfig_PrefetchMapConfig) {
+    const char* mapName = LUA->CheckString(1);
+    RemixAPI::Instance().GetConfigManager().PrefetchMapConfig(mapName);
+    return 0;
+}
+
+// Lua function: RemixConfig.LoadMapConfig(mapName)
+// Applies the map's RTX options as the map layer. Returns nil when neither the map's config
+// nor default.txt has entries, otherwise a table:
+// { path, applied, unchanged, failed, source = { { cvar, value }, ... } }
+LUA_FUNCTION(RemixConfig_LoadMapConfig) {
+    const char* mapName = LUA->CheckString(1);
+    auto& configManager = RemixAPI::Instance().GetConfigManager();
+
+    ConfigManager::LoadedMapConfig loaded;
+    if (!configManager.LoadMapConfig(mapName, loaded)) {
+        LUA->PushNil();
+        return 1;
+    }
+
+    LUA->CreateTable();
+    LUA->PushString(loaded.path.c_str());
+    LUA->SetField(-2, "path");
+    LUA->PushNumber(static_cast<double>(loaded.rtx.applied));
+    LUA->SetField(-2, "applied");
+    LUA->PushNumber(static_cast<double>(loaded.rtx.unchanged));
+    LUA->SetField(-2, "unchanged");
+    LUA->PushNumber(static_cast<double>(loaded.rtx.failed));
+    LUA->SetField(-2, "failed");
+
+    // Source cvars in file order, run by Lua through RunConsoleCommand
+    LUA->CreateTable();
+    for (size_t i = 0; i < loaded.source.size(); ++i) {
+        LUA->PushNumber(static_cast<double>(i + 1));
+        LUA->CreateTable();
+        LUA->PushNumber(1);
+        LUA->PushString(loaded.source[i].first.c_str());
+        LUA->SetTable(-3);
+        LUA->PushNumber(2);
+        LUA->PushString(loaded.source[i].second.c_str());
+        LUA->SetTable(-3);
+        LUA->SetTable(-3);
+    }
+    LUA->SetField(-2, "source");
+    return 1;
+}
+
+static const char* const TEXTURE_HASH_ERROR = "Expected texture hash string like 0x0123456789ABCDEF";
+
+// Reads a texture hash given as a "0x..." string; Lua numbers can't hold 64 bits
+static bool ReadTextureHash(ILuaBase* LUA, int index, uint64_t& out) {
+    return LUA->IsType(index, Type::String) && ParseTextureHash(LUA->GetString(index), out);
+}
+
+// Reads an array of "0x..." hash strings at index (nil for none). Returns the error to raise, or
+// nullptr; it never raises itself so callers can release their C++ locals first.
+static const char* ReadTextureHashes(ILuaBase* LUA, int index, std::vector<uint64_t>& out) {
+    if (LUA->IsType(index, Type::Nil) || LUA->IsType(index, Type::None)) return nullptr;
+    if (!LUA->IsType(index, Type::Table)) return "Expected table of texture hash strings";
+
+    LUA->PushNil();
+    while (LUA->Next(index) != 0) {
+        uint64_t hash = 0;
+        const bool valid = ReadTextureHash(LUA, -1, hash);
+        LUA->Pop();
+        if (!valid) {
+            LUA->Pop(); // the key
+            return TEXTURE_HASH_ERROR;
+        }
+        out.push_back(hash);
+    }
+    return nullptr;
+}
+
+// Lua function: RemixConfig.IsTextureInCategory(key, hash)
+// e.g. RemixConfig.IsTextureInCategory("rtx.ignoreTextures", "0x0109B3A164F3B83E")
+LUA_FUNCTION(RemixConfig_IsTextureInCategory) {
+    const char* key = LUA->CheckString(1);
+    uint64_t hash = 0;
+    if (!ReadTextureHash(LUA, 2, hash)) {
+        LUA->ThrowError(TEXTURE_HASH_ERROR);
+        return 0;
+    }
+    LUA->PushBool(RemixAPI::Instance().GetConfigManager().IsTextureInCategory(key, hash));
+    return 1;
+}
+
+// Lua function: RemixConfig.GetTextureCategorySize(key)
+LUA_FUNCTION(RemixConfig_GetTextureCategorySize) {
+    const char* key = LUA->CheckString(1);
+    LUA->PushNumber(static_cast<double>(RemixAPI::Instance().GetConfigManager().GetTextureCategorySize(key)));
+    return 1;
+}
+
+// Lua function: RemixConfig.EditTextureCategory(key, addHashes, removeHashes)
+// Either table may be nil. Returns added, removed, or nil if the option couldn't be set.
+LUA_FUNCTION(RemixConfig_EditTextureCategory) {
+    const char* key = LUA->CheckString(1);
+    const char* error = nullptr;
+    bool edited = false;
+    ConfigManager::TextureCategoryEdit result;
+    {
+        // ThrowError doesn't unwind C++ frames, so the hash lists are gone before it runs
+        std::vector<uint64_t> add;
+        std::vector<uint64_t> remove;
+        error = ReadTextureHashes(LUA, 2, add);
+        if (!error) error = ReadTextureHashes(LUA, 3, remove);
+        if (!error) edited = RemixAPI::Instance().GetConfigManager().EditTextureCategory(key, add, remove, result);
+    }
+    if (error) {
+        LUA->ThrowError(error);
+        return 0;
+    }
+    if (!edited) {
+        LUA->PushNil();
+        return 1;
+    }
+    LUA->PushNumber(static_cast<double>(result.added));
+    LUA->PushNumber(static_cast<double>(result.removed));
+    return 2;
+}
+
+// Lua function: RemixConfig.MergeTextureFile(dataPath)
+// Unions the rtx.*Textures lists of data/<dataPath> into the current ones.
+// Returns applied, skipped, failed, or nil if the file couldn't be read.
+LUA_FUNCTION(RemixConfig_MergeTextureFile) {
+    const char* dataPath = LUA->CheckString(1);
+    auto& configManager = RemixAPI::Instance().GetConfigManager();
+
+    ConfigManager::ConfigBatchResult result;
+    if (!configManager.MergeTextureFile(dataPath, result)) {
+        LUA->PushNil();
+        return 1;
+    }
+    LUA->PushNumber(static_cast<double>(result.applied));
+    LUA->PushNumber(static_cast<double>(result.skipped));
+    LUA->PushNumber(static_cast<double>(result.failed));
+    return 3;
+}
+
+// Lua function: RemixConfig.Begin()
+// Sets made until the matching Commit are staged; nests
+LUA_FUNCTION(RemixConfig_Begin) {
+    RemixAPI::Instance().GetConfigManager().BeginTransaction();
+    return 0;
+}
+
+// Lua function: RemixConfig.Commit()
+// Returns the number of changed options queued for the next frame
+LUA_FUNCTION(RemixConfig_Commit) {
+    auto& configManager = RemixAPI::Instance().GetConfigManager();
+    LUA->PushNumber(static_cast<double>(configManager.CommitTransaction()));
+    return 1;
+}
+
+// Lua function: RemixConfig.Cancel()
+// Drops everything staged since the outermost Begin
+LUA_FUNCTION(RemixConfig_Cancel) {
+    RemixAPI::Instance().GetConfigManager().CancelTransaction();
+    return 0;
+}
+
 // Lua function: RemixConfig.GetUIState()
 LUA_FUNCTION(RemixConfig_GetUIState) {
     auto& configManager = RemixAPI::Instance().GetConfigManager();
@@ -85,7 +396,7 @@ LUA_FUNCTION(RemixConfig_SetAdvancedUI) {
     bool enabled = LUA->GetBool(1);
     
     auto& configManager = RemixAPI::Instance().GetConfigManager();
-    bool result = configManager.SetConfigVariable("rtx.defaultToAdvancedUI", enabled ? "True" : "False");
+    bool result = configManager.SetConfigValue("rtx.defaultToAdvancedUI", ConfigValue::Bool(enabled));
     
     LUA->PushBool(result);
     return 1;
@@ -100,10 +411,9 @@ LUA_FUNCTION(RemixConfig_SetRaytracing) {
     }
     
     bool enabled = LUA->GetBool(1);
-    std::string value = enabled ? "1" : "0";
     
     auto& configManager = RemixAPI::Instance().GetConfigManager();
-    bool result = configManager.SetConfigVariable("rtx.enableRaytracing", value);
+    bool result = configManager.SetConfigValue("rtx.enableRaytracing", ConfigValue::Bool(enabled));
     
     LUA->PushBool(result);
     return 1;
@@ -118,10 +428,9 @@ LUA_FUNCTION(RemixConfig_SetIgnoreDirectionalLights) {
     }
     
     bool enabled = LUA->GetBool(1);
-    std::string value = enabled ? "1" : "0";
     
     auto& configManager = RemixAPI::Instance().GetConfigManager();
-    bool result = configManager.SetConfigVariable("rtx.ignoreGameDirectionalLights", value);
+    bool result = configManager.SetConfigValue("rtx.ignoreGameDirectionalLights", ConfigValue::Bool(enabled));
     
     LUA->PushBool(result);
     return 1;
@@ -186,11 +495,10 @@ LUA_FUNCTION(RemixConfig_SetRenderResolutionScale) {
         return 1;
     }
     
-    float scale = static_cast<float>(LUA->GetNumber(1));
-    std::string value = std::to_string(scale);
+    double scale = LUA->GetNumber(1);
     
     auto& configManager = RemixAPI::Instance().GetConfigManager();
-    bool result = configManager.SetConfigVariable("rtx.renderResolutionScale", value);
+    bool result = configManager.SetConfigValue("rtx.renderResolutionScale", ConfigValue::Float(scale));
     
     LUA->PushBool(result);
     return 1;
@@ -205,10 +513,9 @@ LUA_FUNCTION(RemixConfig_SetMaxBounces) {
     }
     
     int bounces = static_cast<int>(LUA->GetNumber(1));
-    std::string value = std::to_string(bounces);
     
     auto& configManager = RemixAPI::Instance().GetConfigManager();
-    bool result = configManager.SetConfigVariable("rtx.maxBounces", value);
+    bool result = configManager.SetConfigValue("rtx.maxBounces", ConfigValue::Int(bounces));
     
     LUA->PushBool(result);
     return 1;
@@ -223,10 +530,9 @@ LUA_FUNCTION(RemixConfig_SetVolumetricEnabled) {
     }
     
     bool enabled = LUA->GetBool(1);
-    std::string value = enabled ? "1" : "0";
     
     auto& configManager = RemixAPI::Instance().GetConfigManager();
-    bool result = configManager.SetConfigVariable("rtx.volumetricEnabled", value);
+    bool result = configManager.SetConfigValue("rtx.volumetricEnabled", ConfigValue::Bool(enabled));
     
     LUA->PushBool(result);
     return 1;
@@ -250,6 +556,48 @@ void ConfigManager::InitializeLuaBindings() {
     m_lua->PushCFunction(RemixConfig_GetConfigVariable);
     m_lua->SetField(-2, "GetConfigVariable");
     
+    m_lua->PushCFunction(RemixConfig_GetConfigValue);
+    m_lua->SetField(-2, "GetConfigValue");
+    
+    m_lua->PushCFunction(RemixConfig_SetMany);
+    m_lua->SetField(-2, "SetMany");
+    
+    m_lua->PushCFunction(RemixConfig_ReloadConfigFile);
+    m_lua->SetField(-2, "ReloadConfigFile");
+    
+    m_lua->PushCFunction(RemixConfig_GetConfigLayer);
+    m_lua->SetField(-2, "GetConfigLayer");
+    
+    m_lua->PushCFunction(RemixConfig_ApplyMapConfig);
+    m_lua->SetField(-2, "ApplyMapConfig");
+    
+    m_lua->PushCFunction(RemixConfig_IsTextureInCategory);
+    m_lua->SetField(-2, "IsTextureInCategory");
+    
+    m_lua->PushCFunction(RemixConfig_GetTextureCategorySize);
+    m_lua->SetField(-2, "GetTextureCategorySize");
+    
+    m_lua->PushCFunction(RemixConfig_EditTextureCategory);
+    m_lua->SetField(-2, "EditTextureCategory");
+    
+    m_lua->PushCFunction(RemixConfig_MergeTextureFile);
+    m_lua->SetField(-2, "MergeTextureFile");
+    
+    m_lua->PushCFunction(RemixConfig_PrefetchMapConfig);
+    m_lua->SetField(-2, "PrefetchMapConfig");
+    
+    m_lua->PushCFunction(RemixConfig_LoadMapConfig);
+    m_lua->SetField(-2, "LoadMapConfig");
+    
+    m_lua->PushCFunction(RemixConfig_Begin);
+    m_lua->SetField(-2, "Begin");
+    
+    m_lua->PushCFunction(RemixConfig_Commit);
+    m_lua->SetField(-2, "Commit");
+    
+    m_lua->PushCFunction(RemixConfig_Cancel);
+    m_lua->SetField(-2, "Cancel");
+    
     // UI state functions
     m_lua->PushCFunction(RemixConfig_GetUIState);
     m_lua->SetField(-2, "GetUIState");
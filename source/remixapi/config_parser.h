@@ -0,0 +1,81 @@
+#pragma once
+
+#include "../worldapi/mapped_file.h"
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace RemixAPI {
+
+namespace detail {
+    constexpr bool IsConfigSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    constexpr std::string_view TrimConfigField(std::string_view text) {
+        while (!text.empty() && IsConfigSpace(text.front())) text.remove_prefix(1);
+        while (!text.empty() && IsConfigSpace(text.back())) text.remove_suffix(1);
+        return text;
+    }
+}
+
+// Streams "key = value" lines of rtx.conf-style text into visit(key, value) without copying:
+// both views point into text. Blank lines and lines starting with '#' or ';' are skipped, key
+// and value are trimmed and one pair of surrounding quotes is dropped from the value. Repeated
+// keys are all reported, in file order. A visitor returning bool can return false to stop.
+// Returns the number of pairs visited.
+template <typename Visitor>
+size_t VisitConfigText(std::string_view text, Visitor&& visit) {
+    // UTF-8 BOM from editors that add one
+    if (text.size() >= 3 && text.compare(0, 3, "\xEF\xBB\xBF") == 0) text.remove_prefix(3);
+
+    size_t visited = 0;
+    const char* cursor = text.data();
+    const char* const end = text.data() + text.size();
+    while (cursor < end) {
+        const char* newline = static_cast<const char*>(std::memchr(cursor, '\n', static_cast<size_t>(end - cursor)));
+        const char* lineEnd = newline ? newline : end;
+        std::string_view line(cursor, static_cast<size_t>(lineEnd - cursor));
+        cursor = newline ? newline + 1 : end;
+
+        while (!line.empty() && detail::IsConfigSpace(line.front())) line.remove_prefix(1);
+        if (line.empty() || line.front() == '#' || line.front() == ';') continue;
+
+        // Keys never contain '=', so the first one splits the line however long the value is
+        const size_t equals = line.find('=');
+        if (equals == std::string_view::npos) continue;
+
+        const std::string_view key = detail::TrimConfigField(line.substr(0, equals));
+        std::string_view value = detail::TrimConfigField(line.substr(equals + 1));
+        if (key.empty()) continue;
+        if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+            value = value.substr(1, value.size() - 2);
+        }
+
+        ++visited;
+        if constexpr (std::is_same_v<std::invoke_result_t<Visitor&, std::string_view, std::string_view>, bool>) {
+            if (!visit(key, value)) break;
+        } else {
+            visit(key, value);
+        }
+    }
+    return visited;
+}
+
+// Memory-maps path and streams it through VisitConfigText; the views are only valid inside
+// the visitor. Returns false if the file can't be mapped (missing, unreadable or empty).
+template <typename Visitor>
+bool VisitConfigFile(const std::string& path, Visitor&& visit, size_t* visited = nullptr) {
+    WorldAPI::MappedFile file;
+    if (!file.Open(path)) return false;
+
+    const std::string_view text(reinterpret_cast<const char*>(file.Data()), file.Size());
+    const size_t count = VisitConfigText(text, visit);
+    if (visited) *visited = count;
+    return true;
+}
+
+} // namespace RemixAPI
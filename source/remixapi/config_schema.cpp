@@ -0,0 +1,340 @@
+#include "config_schema.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace RemixAPI {
+
+namespace {
+
+    struct RtxOptionRange {
+        std::string_view key;
+        double min;
+        double max;
+    };
+
+    // Ranges RtxOptions.md states for options we drive from Lua. Sorted by key.
+    constexpr RtxOptionRange RTX_OPTION_RANGES[] = {
+        {"rtx.pathMaxBounces", 0.0, 15.0},          // "Must be < 16"
+        {"rtx.pathMinBounces", 0.0, 15.0},          // "Must be < 16"
+        {"rtx.psrrMaxBounces", 0.0, 15.0},          // payload encoding
+        {"rtx.pstrMaxBounces", 0.0, 15.0},          // payload encoding
+        {"rtx.showUI", 0.0, 2.0},                   // None, Basic, Advanced
+        {"rtx.volumetrics.anisotropy", -1.0, 1.0},  // back to forward scattering
+    };
+
+    std::string_view TrimConfigText(std::string_view text) {
+        while (!text.empty() && (text.front() == ' ' || text.front() == '\t' || text.front() == '\r' || text.front() == '\n')) text.remove_prefix(1);
+        while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r' || text.back() == '\n')) text.remove_suffix(1);
+        return text;
+    }
+
+    bool EqualsIgnoreCase(std::string_view a, std::string_view b) {
+        if (a.size() != b.size()) return false;
+        for (size_t i = 0; i < a.size(); ++i) {
+            char x = a[i], y = b[i];
+            if (x >= 'A' && x <= 'Z') x = static_cast<char>(x - 'A' + 'a');
+            if (y >= 'A' && y <= 'Z') y = static_cast<char>(y - 'A' + 'a');
+            if (x != y) return false;
+        }
+        return true;
+    }
+
+    bool ParseBoolText(std::string_view text, bool& out) {
+        if (text == "1" || EqualsIgnoreCase(text, "true") || EqualsIgnoreCase(text, "yes") || EqualsIgnoreCase(text, "on")) {
+            out = true;
+            return true;
+        }
+        if (text == "0" || EqualsIgnoreCase(text, "false") || EqualsIgnoreCase(text, "no") || EqualsIgnoreCase(text, "off")) {
+            out = false;
+            return true;
+        }
+        return false;
+    }
+
+    bool ParseNumberText(std::string_view text, double& out, bool& isInteger) {
+        text = TrimConfigText(text);
+        // Decimal only: strtod would also take hex, and a 64-bit texture hash isn't a number
+        if (text.empty() || text.size() > 64 || text.find_first_not_of("0123456789+-.eE") != std::string_view::npos) return false;
+
+        char buffer[65];
+        text.copy(buffer, text.size());
+        buffer[text.size()] = '\0';
+
+        char* end = nullptr;
+        out = std::strtod(buffer, &end);
+        if (end != buffer + text.size() || !std::isfinite(out)) return false;
+        isInteger = text.find_first_of(".eE") == std::string_view::npos;
+        return true;
+    }
+
+    // Up to three comma separated numbers
+    bool ParseComponents(std::string_view text, double (&values)[3], uint8_t& count, bool& allIntegers) {
+        count = 0;
+        allIntegers = true;
+        while (true) {
+            const size_t comma = text.find(',');
+            bool isInteger = false;
+            if (count == 3 || !ParseNumberText(text.substr(0, comma), values[count], isInteger)) return false;
+            ++count;
+            allIntegers = allIntegers && isInteger;
+            if (comma == std::string_view::npos) return true;
+            text.remove_prefix(comma + 1);
+        }
+    }
+
+    // Shortest spelling that reads back to the same double
+    std::string FormatNumber(double value, bool forceDecimal) {
+        char buffer[32];
+        for (int precision = 1; precision <= 17; ++precision) {
+            std::snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+            if (std::strtod(buffer, nullptr) == value) break;
+        }
+        std::string text(buffer);
+        if (forceDecimal && text.find_first_of(".eEn") == std::string::npos) text += ".0";
+        return text;
+    }
+
+    std::string FormatValue(const ConfigValue& value) {
+        switch (value.type) {
+            case RtxOptionType::Bool: return value.data.b ? "True" : "False";
+            case RtxOptionType::Int: return std::to_string(value.data.i);
+            case RtxOptionType::Float: return FormatNumber(value.data.f, true);
+            case RtxOptionType::Vector: {
+                std::string text;
+                for (uint8_t i = 0; i < value.count; ++i) {
+                    if (i) text += ", ";
+                    text += FormatNumber(value.data.v[i], false);
+                }
+                return text;
+            }
+            default: return value.text;
+        }
+    }
+
+} // namespace
+
+ConfigValue ConfigValue::Bool(bool value) {
+    ConfigValue result;
+    result.type = RtxOptionType::Bool;
+    result.count = 1;
+    result.data.b = value;
+    result.text = value ? "True" : "False";
+    return result;
+}
+
+ConfigValue ConfigValue::Int(int64_t value) {
+    ConfigValue result;
+    result.type = RtxOptionType::Int;
+    result.count = 1;
+    result.data.i = value;
+    result.text = std::to_string(value);
+    return result;
+}
+
+ConfigValue ConfigValue::Float(double value) {
+    ConfigValue result;
+    result.type = RtxOptionType::Float;
+    result.count = 1;
+    result.data.f = value;
+    result.text = FormatNumber(value, true);
+    return result;
+}
+
+ConfigValue ConfigValue::String(std::string_view value) {
+    ConfigValue result;
+    result.text = std::string(value);
+    return result;
+}
+
+double ConfigValue::Component(size_t index) const {
+    switch (type) {
+        case RtxOptionType::Bool: return index == 0 && data.b ? 1.0 : 0.0;
+        case RtxOptionType::Int: return index == 0 ? static_cast<double>(data.i) : 0.0;
+        case RtxOptionType::Float: return index == 0 ? data.f : 0.0;
+        case RtxOptionType::Vector: return index < count ? data.v[index] : 0.0;
+        default: return 0.0;
+    }
+}
+
+ConfigOptionSchema GetConfigSchema(std::string_view key) {
+    ConfigOptionSchema schema;
+    schema.key = key;
+    schema.defaultValue = FindRtxOptionDefault(key);
+    if (schema.defaultValue) {
+        schema.known = true;
+        schema.type = schema.defaultValue->type;
+    }
+
+    size_t low = 0;
+    size_t high = sizeof(RTX_OPTION_RANGES) / sizeof(RTX_OPTION_RANGES[0]);
+    while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        if (RTX_OPTION_RANGES[mid].key < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low < sizeof(RTX_OPTION_RANGES) / sizeof(RTX_OPTION_RANGES[0]) && RTX_OPTION_RANGES[low].key == key) {
+        schema.hasRange = true;
+        schema.min = RTX_OPTION_RANGES[low].min;
+        schema.max = RTX_OPTION_RANGES[low].max;
+    }
+    return schema;
+}
+
+bool ParseConfigValue(const ConfigOptionSchema& schema, std::string_view text, ConfigValue& out) {
+    text = TrimConfigText(text);
+    if (text.size() >= 2 && text.front() == '"' && text.back() == '"') {
+        text = TrimConfigText(text.substr(1, text.size() - 2));
+    }
+
+    out = ConfigValue();
+    out.text = std::string(text);
+
+    double values[3] = { 0.0, 0.0, 0.0 };
+    uint8_t count = 0;
+    bool allIntegers = false;
+
+    if (!schema.known) {
+        // Infer: True/False, up to three numbers, anything else stays a string. The text is kept
+        // as given so long hex lists and the like round-trip untouched.
+        if (EqualsIgnoreCase(text, "true") || EqualsIgnoreCase(text, "false")) {
+            out = ConfigValue::Bool(EqualsIgnoreCase(text, "true"));
+        } else if (ParseComponents(text, values, count, allIntegers)) {
+            out.count = count;
+            if (count > 1) {
+                out.type = RtxOptionType::Vector;
+                for (uint8_t i = 0; i < count; ++i) out.data.v[i] = values[i];
+            } else if (allIntegers && std::fabs(values[0]) < 9.0e15) {
+                out.type = RtxOptionType::Int;
+                out.data.i = static_cast<int64_t>(values[0]);
+            } else {
+                out.type = RtxOptionType::Float;
+                out.data.f = values[0];
+            }
+        }
+        return true;
+    }
+
+    switch (schema.type) {
+        case RtxOptionType::Bool: {
+            bool enabled = false;
+            if (!ParseBoolText(text, enabled)) return false;
+            out = ConfigValue::Bool(enabled);
+            return true;
+        }
+        case RtxOptionType::Int:
+        case RtxOptionType::Float: {
+            if (!ParseComponents(text, values, count, allIntegers) || count != 1) return false;
+            out.type = schema.type;
+            out.count = 1;
+            if (schema.type == RtxOptionType::Int) {
+                if (std::fabs(values[0]) >= 9.0e15) return false;
+                out.data.i = static_cast<int64_t>(std::llround(values[0]));
+                if (!allIntegers) out.text = std::to_string(out.data.i);
+            } else {
+                out.data.f = values[0];
+            }
+            return true;
+        }
+        case RtxOptionType::Vector: {
+            if (!ParseComponents(text, values, count, allIntegers)) return false;
+            if (schema.defaultValue && count != schema.defaultValue->count) return false;
+            out.type = RtxOptionType::Vector;
+            out.count = count;
+            for (uint8_t i = 0; i < count; ++i) out.data.v[i] = values[i];
+            return true;
+        }
+        default:
+            return true;
+    }
+}
+
+bool CoerceConfigValue(const ConfigOptionSchema& schema, ConfigValue& value) {
+    if (!schema.known || value.type == schema.type) return true;
+
+    const bool fromNumber = value.type == RtxOptionType::Bool || value.type == RtxOptionType::Int || value.type == RtxOptionType::Float;
+    if (!fromNumber) {
+        // Text goes through the parser
+        const std::string text = value.text;
+        return ParseConfigValue(schema, text, value);
+    }
+
+    const double number = value.Component(0);
+    switch (schema.type) {
+        case RtxOptionType::Bool: value = ConfigValue::Bool(number != 0.0); return true;
+        case RtxOptionType::Int: value = ConfigValue::Int(static_cast<int64_t>(std::llround(number))); return true;
+        case RtxOptionType::Float: value = ConfigValue::Float(number); return true;
+        case RtxOptionType::Vector: {
+            // A single number sets every component ("1" for a colour is white)
+            const uint8_t count = schema.defaultValue ? schema.defaultValue->count : 3;
+            ConfigValue vector;
+            vector.type = RtxOptionType::Vector;
+            vector.count = count;
+            for (uint8_t i = 0; i < count; ++i) vector.data.v[i] = number;
+            vector.text = FormatValue(vector);
+            value = std::move(vector);
+            return true;
+        }
+        default:
+            value = ConfigValue::String(FormatValue(value));
+            return true;
+    }
+}
+
+bool ClampConfigValue(const ConfigOptionSchema& schema, ConfigValue& value) {
+    if (!schema.hasRange || !value.IsNumeric() || value.type == RtxOptionType::Bool) return false;
+
+    bool clamped = false;
+    auto clamp = [&](double component) {
+        if (component < schema.min) { clamped = true; return schema.min; }
+        if (component > schema.max) { clamped = true; return schema.max; }
+        return component;
+    };
+
+    switch (value.type) {
+        case RtxOptionType::Int: value.data.i = static_cast<int64_t>(clamp(static_cast<double>(value.data.i))); break;
+        case RtxOptionType::Float: value.data.f = clamp(value.data.f); break;
+        case RtxOptionType::Vector:
+            for (uint8_t i = 0; i < value.count; ++i) value.data.v[i] = clamp(value.data.v[i]);
+            break;
+        default: break;
+    }
+
+    if (clamped) value.text = FormatValue(value);
+    return clamped;
+}
+
+bool ConfigValuesEqual(const ConfigValue& a, const ConfigValue& b) {
+    if (a.IsNumeric() && b.IsNumeric()) {
+        const uint8_t count = a.count > b.count ? a.count : b.count;
+        if (a.count != b.count && a.type == RtxOptionType::Vector && b.type == RtxOptionType::Vector) return false;
+        for (uint8_t i = 0; i < count; ++i) {
+            if (a.Component(i) != b.Component(i)) return false;
+        }
+        return true;
+    }
+    return a.text == b.text;
+}
+
+ConfigValue MakeDefaultConfigValue(const RtxOptionDefault& option) {
+    ConfigValue value;
+    value.type = option.type;
+    value.count = option.count;
+    value.text = std::string(option.text);
+    switch (option.type) {
+        case RtxOptionType::Bool: value.data.b = option.AsBool(); break;
+        case RtxOptionType::Int: value.data.i = static_cast<int64_t>(option.values[0]); break;
+        case RtxOptionType::Float: value.data.f = option.values[0]; break;
+        case RtxOptionType::Vector:
+            for (uint8_t i = 0; i < option.count && i < 3; ++i) value.data.v[i] = option.values[i];
+            break;
+        default: break;
+    }
+    return value;
+}
+
+} // namespace RemixAPI
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "rtx_option_defaults.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace RemixAPI {
+
+    // One config value, parsed once. Numeric types keep their components in data so
+    // comparisons and clamping never go back through text; text is the spelling sent to Remix.
+    struct ConfigValue {
+        RtxOptionType type = RtxOptionType::String;
+        uint8_t count = 0;
+        union {
+            bool b;
+            int64_t i;
+            double f;
+            double v[3];
+        } data {};
+        std::string text;
+
+        static ConfigValue Bool(bool value);
+        static ConfigValue Int(int64_t value);
+        static ConfigValue Float(double value);
+        static ConfigValue String(std::string_view value);
+
+        // Component as double whatever the numeric type (0 for strings)
+        double Component(size_t index) const;
+        bool IsNumeric() const { return type != RtxOptionType::String; }
+    };
+
+    // What we know about an option: its type and default from RTX_OPTION_DEFAULTS, plus a valid
+    // range where Remix documents one. Unknown options have no default and take their type
+    // from whatever value they're given.
+    struct ConfigOptionSchema {
+        std::string_view key;
+        RtxOptionType type = RtxOptionType::String;
+        bool known = false;
+        bool hasRange = false;
+        double min = 0.0;
+        double max = 0.0;
+        const RtxOptionDefault* defaultValue = nullptr;
+    };
+
+    ConfigOptionSchema GetConfigSchema(std::string_view key);
+
+    // Parses text as the option's type (inferred for unknown options). Bools accept
+    // 1/0, true/false, yes/no, on/off in any case; quotes and surrounding whitespace are
+    // dropped. Returns false when text doesn't fit a typed option.
+    bool ParseConfigValue(const ConfigOptionSchema& schema, std::string_view text, ConfigValue& out);
+
+    // Converts a value built from a Lua number or bool to the option's type
+    bool CoerceConfigValue(const ConfigOptionSchema& schema, ConfigValue& value);
+
+    // Clamps numeric components into the schema's range and re-spells text if anything moved.
+    // Returns true if the value was clamped.
+    bool ClampConfigValue(const ConfigOptionSchema& schema, ConfigValue& value);
+
+    // Numeric types compare by value ("1.0" == "1"), strings by text
+    bool ConfigValuesEqual(const ConfigValue& a, const ConfigValue& b);
+
+    ConfigValue MakeDefaultConfigValue(const RtxOptionDefault& option);
+
+} // namespace RemixAPI
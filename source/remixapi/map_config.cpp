@@ -0,0 +1,42 @@
+#include "map_config.h"
+#include "config_parser.h"
+
+namespace RemixAPI {
+
+namespace {
+
+    void AddMapConfigEntry(std::string_view key, std::string_view value, MapConfigFile& out) {
+        // Inline comments; keys can't hold one, the line would have been skipped
+        const size_t comment = value.find('#');
+        if (comment != std::string_view::npos) {
+            value = detail::TrimConfigField(value.substr(0, comment));
+        }
+        if (value.empty()) return;
+
+        if (key.compare(0, 4, "src:") == 0) {
+            key.remove_prefix(4);
+            if (!key.empty()) out.source.emplace_back(std::string(key), std::string(value));
+            return;
+        }
+        if (key.compare(0, 4, "rtx:") == 0) {
+            key.remove_prefix(4);
+        }
+        if (!key.empty()) out.rtx.emplace_back(std::string(key), ConfigValue::String(value));
+    }
+
+} // namespace
+
+void ReadMapConfigText(std::string_view text, MapConfigFile& out) {
+    VisitConfigText(text, [&](std::string_view key, std::string_view value) {
+        AddMapConfigEntry(key, value, out);
+    });
+}
+
+bool ReadMapConfigFile(const std::string& path, MapConfigFile& out) {
+    out.path = path;
+    return VisitConfigFile(path, [&](std::string_view key, std::string_view value) {
+        AddMapConfigEntry(key, value, out);
+    });
+}
+
+} // namespace RemixAPI
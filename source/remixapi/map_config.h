@@ -0,0 +1,28 @@
+#pragma once
+
+#include "config_schema.h"
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace RemixAPI {
+
+    // A per-map config file (data/remix_map_configs/<map>.txt). Lines are "rtx:key = value" for
+    // Remix options, "src:cvar = value" for Source cvars and plain "key = value" for Remix options
+    // in the legacy format; '#' starts a comment anywhere on a line.
+    struct MapConfigFile {
+        std::string path;
+        std::vector<std::pair<std::string, ConfigValue>> rtx;        // unparsed, typed on apply
+        std::vector<std::pair<std::string, std::string>> source;     // file order
+
+        bool Empty() const { return rtx.empty() && source.empty(); }
+    };
+
+    void ReadMapConfigText(std::string_view text, MapConfigFile& out);
+
+    // Returns false when the file is missing, unreadable or empty
+    bool ReadMapConfigFile(const std::string& path, MapConfigFile& out);
+
+} // namespace RemixAPI
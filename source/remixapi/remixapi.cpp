@@ -1,13 +1,14 @@
 #ifdef _WIN64
 #include "remixapi.h"
+#include "config_parser.h"
+#include "../worldapi/game_paths.h"
 #include "rtx_option_defaults.h"
 #include <Windows.h>
 #include <remix/remix_c.h>
 #include <tier0/dbg.h>
 #include <algorithm>
 #include <filesystem>
-#include <fstream>
-#include <sstream>
+#include <system_error>
 
 // Lua bindings are implemented in separate .cpp files that are compiled independently
 // No need to include them here since they define their own functions
@@ -86,6 +87,10 @@ bool RemixAPI::Initialize(remix::Interface* remixInterface, GarrysMod::Lua::ILua
         m_lightManager->InitializeLuaBindings();
 
     m_initialized = true;
+    {
+        std::lock_guard<std::mutex> lock(m_presentMutex);
+        m_presentConfigManager = m_configManager.get();
+    }
     Msg("[RemixAPI] Initialization complete\n");
     return true;
 }
@@ -93,6 +98,12 @@ bool RemixAPI::Initialize(remix::Interface* remixInterface, GarrysMod::Lua::ILua
 void RemixAPI::Shutdown() {
     if (!m_initialized) return;
 
+    // Waits for a present callback that is running right now
+    {
+        std::lock_guard<std::mutex> lock(m_presentMutex);
+        m_presentConfigManager = nullptr;
+    }
+
     m_resourceManager.reset();
     m_lightManager.reset();
     m_configManager.reset();
@@ -108,6 +119,13 @@ void RemixAPI::Shutdown() {
     Msg("[RemixAPI] Shutdown complete\n");
 }
 
+void RemixAPI::OnPresentCallback() {
+    // Remix's thread: only touches what Initialize/Shutdown publish under m_presentMutex
+    std::lock_guard<std::mutex> lock(m_presentMutex);
+    if (!m_presentConfigManager) return;
+    m_presentConfigManager->ApplyPendingAtPresent();
+}
+
 void RemixAPI::Present() {
     if (!m_initialized || !m_remixInterface) return;
     
@@ -158,6 +176,38 @@ uint64_t LightManager::CreateSphereLight(const remix::LightInfo& base, const rem
     return id;
 }
 
+std::vector<uint64_t> LightManager::CreateSphereLights(const std::vector<SphereLightRequest>& requests) {
+    std::vector<uint64_t> ids(requests.size(), 0);
+    if (!m_remixInterface) return ids;
+
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_lights.reserve(m_lights.size() + requests.size());
+
+    size_t failed = 0;
+    for (size_t i = 0; i < requests.size(); ++i) {
+        const SphereLightRequest& request = requests[i];
+        remix::LightInfo info = request.base;
+        info.pNext = const_cast<remix::LightInfoSphereEXT*>(&request.sphere);
+
+        auto created = m_remixInterface->CreateLightBatched(info);
+        if (!created) {
+            ++failed;
+            continue;
+        }
+
+        uint64_t id = m_nextLightId++;
+        ManagedLight ml; ml.handle = created.value(); ml.entityId = request.entityId; ml.isSphere = true; ml.cachedBase = request.base; ml.cachedBase.pNext = nullptr; ml.cachedSphere = request.sphere;
+        m_lights.emplace(id, std::move(ml));
+        if (request.entityId) m_entityToLight.emplace(request.entityId, id);
+        ids[i] = id;
+    }
+
+    if (failed) {
+        Warning("[LightManager] Failed to create %zu of %zu sphere lights\n", failed, requests.size());
+    }
+    return ids;
+}
+
 uint64_t LightManager::CreateRectLight(const remix::LightInfo& base, const remix::LightInfoRectEXT& ext, uint64_t entityId) {
     if (!m_remixInterface) return 0;
     
@@ -724,15 +774,132 @@ ConfigManager::ConfigManager(remix::Interface* remixInterface, GarrysMod::Lua::I
 ConfigManager::~ConfigManager() {
 }
 
+bool ConfigManager::PrepareConfigValue(const std::string& key, ConfigValue& value) const {
+    const ConfigOptionSchema schema = GetConfigSchema(key);
+
+    // Text is parsed as the option's type once; numbers and bools from Lua are converted to it
+    const bool parsed = value.type == RtxOptionType::String
+        ? ParseConfigValue(schema, std::string(value.text), value)
+        : CoerceConfigValue(schema, value);
+    if (!parsed) {
+        Warning("[ConfigManager] '%s' is not a valid value for %s\n", value.text.c_str(), key.c_str());
+        return false;
+    }
+
+    if (ClampConfigValue(schema, value)) {
+        Warning("[ConfigManager] %s clamped to %s (valid range %g to %g)\n", key.c_str(), value.text.c_str(), schema.min, schema.max);
+    }
+    return true;
+}
+
+bool ConfigManager::IsKnownCurrent(const std::string& key, const ConfigValue& value) {
+    // Only the map and runtime layers hold values we sent ourselves; rtx.conf and the defaults
+    // may have been changed since through the Remix UI
+    ConfigLayer layer = ConfigLayer::None;
+    const ConfigValue* current = ResolveConfigVariable(key, &layer);
+    return current && (layer == ConfigLayer::Map || layer == ConfigLayer::Runtime) && ConfigValuesEqual(*current, value);
+}
+
 bool ConfigManager::SetConfigVariable(const std::string& key, const std::string& value) {
+    return SetConfigValue(key, ConfigValue::String(value));
+}
+
+bool ConfigManager::SetConfigValue(const std::string& key, ConfigValue value) {
     if (!m_remixInterface) return false;
+    if (!PrepareConfigValue(key, value)) return false;
+
+    if (m_transactionDepth > 0) {
+        m_stagedConfig.insert_or_assign(key, std::move(value));
+        return true;
+    }
+
+    // A direct set supersedes anything still waiting for the present callback. If it dropped a
+    // value, the runtime layer holds one Remix never got, so the set can't be skipped.
+    const bool droppedPending = DropPendingValue(key);
+    if (!droppedPending && IsKnownCurrent(key, value)) {
+        return true;
+    }
+
+    if (!SubmitConfigVariable(key, value)) {
+        if (droppedPending && m_runtimeConfig.erase(key)) ++m_configGeneration;
+        return false;
+    }
+
+    m_runtimeConfig[key] = std::move(value);
+    ++m_configGeneration;
+    return true;
+}
+
+std::vector<std::pair<std::string, ConfigValue>> ConfigManager::PrepareConfigBatch(const std::vector<std::pair<std::string, ConfigValue>>& values, size_t& rejected) const {
+    // Sorted by key so a batch always reaches Remix in the same order; the last value given
+    // for a key wins
+    std::vector<std::pair<std::string, ConfigValue>> batch;
+    batch.reserve(values.size());
+    for (const auto& entry : values) {
+        if (entry.first.empty()) continue;
+        batch.push_back(entry);
+    }
+    std::stable_sort(batch.begin(), batch.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::vector<std::pair<std::string, ConfigValue>> prepared;
+    prepared.reserve(batch.size());
+    for (size_t i = 0; i < batch.size(); ++i) {
+        if (i + 1 < batch.size() && batch[i + 1].first == batch[i].first) continue;
+        if (!PrepareConfigValue(batch[i].first, batch[i].second)) {
+            ++rejected;
+            continue;
+        }
+        prepared.push_back(std::move(batch[i]));
+    }
+    return prepared;
+}
+
+ConfigManager::ConfigBatchResult ConfigManager::SetConfigVariables(const std::vector<std::pair<std::string, ConfigValue>>& values) {
+    ConfigBatchResult result;
+    if (!m_remixInterface) {
+        result.failed = values.size();
+        return result;
+    }
+
+    auto batch = PrepareConfigBatch(values, result.failed);
+    result.skipped = values.size() - batch.size() - result.failed;
+
+    if (m_transactionDepth > 0) {
+        // Counted as applied once the transaction commits
+        for (auto& entry : batch) {
+            m_stagedConfig.insert_or_assign(std::move(entry.first), std::move(entry.second));
+        }
+        result.applied = batch.size();
+        return result;
+    }
+
+    for (const auto& entry : batch) {
+        // See SetConfigValue
+        const bool droppedPending = DropPendingValue(entry.first);
+        if (!droppedPending && IsKnownCurrent(entry.first, entry.second)) {
+            ++result.skipped;
+            continue;
+        }
+        if (SubmitConfigVariable(entry.first, entry.second)) {
+            m_runtimeConfig[entry.first] = entry.second;
+            ++m_configGeneration;
+            ++result.applied;
+        } else {
+            if (droppedPending && m_runtimeConfig.erase(entry.first)) ++m_configGeneration;
+            ++result.failed;
+        }
+    }
+
+    return result;
+}
 
+bool ConfigManager::SubmitConfigVariable(const std::string& key, const ConfigValue& value) {
     // Handle deprecated/invalid config variables with suggestions
     if (key == "rtx.enableAdvancedMode") {
         Warning("[ConfigManager] 'rtx.enableAdvancedMode' is not a valid RTX option. Use 'rtx.showUI' (0=Don't Show, 1=Show Simple, 2=Show Advanced) or 'rtx.defaultToAdvancedUI' (True/False) instead.\n");
         
         // Auto-convert to the correct option
-        if (value == "1" || value == "true" || value == "True") {
+        if (value.IsNumeric() && value.Component(0) != 0.0) {
             // Try to set advanced UI as default
             auto result = m_remixInterface->SetConfigVariable("rtx.defaultToAdvancedUI", "True");
             if (result) {
@@ -742,7 +909,7 @@ bool ConfigManager::SetConfigVariable(const std::string& key, const std::string&
         return false;
     }
 
-    auto result = m_remixInterface->SetConfigVariable(key.c_str(), value.c_str());
+    auto result = m_remixInterface->SetConfigVariable(key.c_str(), value.text.c_str());
     if (!result) {
         Error("[ConfigManager] Failed to set config variable '%s': %d\n", key.c_str(), result.status());
         return false;
@@ -752,152 +919,481 @@ bool ConfigManager::SetConfigVariable(const std::string& key, const std::string&
 }
 
 std::string ConfigManager::GetConfigVariable(const std::string& key) {
-    // Try to read from rtx.conf file first
-    std::string confPath = FindRtxConfPath();
-    if (!confPath.empty() && std::filesystem::exists(confPath)) {
-        std::unordered_map<std::string, std::string> fileConfig = ParseConfigFile(confPath);
-        auto fileIt = fileConfig.find(key);
-        if (fileIt != fileConfig.end()) {
-            return fileIt->second;
-        }
-    }
+    const ConfigValue* value = ResolveConfigVariable(key, nullptr);
     
-    // If not found in file, return empty string (no default fallback)
+    // Unknown everywhere: return empty string
     // Note: RTX Remix API doesn't support reading config variables back
-    return "";
+    return value ? value->text : "";
 }
 
+const ConfigValue* ConfigManager::GetConfigValue(const std::string& key) {
+    return ResolveConfigVariable(key, nullptr);
+}
 
+ConfigLayer ConfigManager::GetConfigLayer(const std::string& key) {
+    ConfigLayer layer = ConfigLayer::None;
+    ResolveConfigVariable(key, &layer);
+    return layer;
+}
 
-remix::UIState ConfigManager::GetUIState() {
-    if (!m_remixInterface) return remix::UIState::None;
+const ConfigValue* ConfigManager::ResolveConfigVariable(const std::string& key, ConfigLayer* layer) {
+    auto found = [&](const ConfigValue& value, ConfigLayer source) {
+        if (layer) *layer = source;
+        return &value;
+    };
 
-    auto result = m_remixInterface->GetUIState();
-    if (!result) {
-        Error("[ConfigManager] Failed to get UI state: %d\n", result.status());
-        return remix::UIState::None;
+    ReconcilePendingFailures();
+    auto runtimeIt = m_runtimeConfig.find(key);
+    if (runtimeIt != m_runtimeConfig.end()) return found(runtimeIt->second, ConfigLayer::Runtime);
+
+    auto mapIt = m_mapConfig.find(key);
+    if (mapIt != m_mapConfig.end()) return found(mapIt->second, ConfigLayer::Map);
+
+    // The file layer is served from the rtx.conf mirror; the file is only touched when it changed on disk
+    RefreshConfigMirror(false);
+    auto fileIt = m_fileConfig.find(key);
+    if (fileIt != m_fileConfig.end()) return found(fileIt->second, ConfigLayer::File);
+
+    // Defaults are materialised the first time each one is asked for
+    auto defaultIt = m_defaultConfig.find(key);
+    if (defaultIt == m_defaultConfig.end()) {
+        const RtxOptionDefault* option = FindRtxOptionDefault(key);
+        if (option) defaultIt = m_defaultConfig.emplace(key, MakeDefaultConfigValue(*option)).first;
     }
-    
-    return result.value();
+    if (defaultIt != m_defaultConfig.end()) return found(defaultIt->second, ConfigLayer::Default);
+
+    if (layer) *layer = ConfigLayer::None;
+    return nullptr;
 }
 
-bool ConfigManager::SetUIState(remix::UIState state) {
-    if (!m_remixInterface) return false;
+ConfigManager::MapConfigResult ConfigManager::ApplyMapConfig(const std::vector<std::pair<std::string, ConfigValue>>& values) {
+    MapConfigResult result;
+    if (!m_remixInterface) {
+        result.failed = values.size();
+        return result;
+    }
 
-    auto result = m_remixInterface->SetUIState(state);
-    if (!result) {
-        Error("[ConfigManager] Failed to set UI state: %d\n", result.status());
-        return false;
+    // Same order every load, see PrepareConfigBatch
+    const auto incoming = PrepareConfigBatch(values, result.failed);
+
+    // What Remix is known to hold right now for everything the old or new map layer touches.
+    // Like IsKnownCurrent, only values we sent count: an option only rtx.conf or the defaults
+    // speak for may have been changed through the Remix UI, so the map re-asserts it.
+    std::unordered_map<std::string, ConfigValue> before;
+    auto snapshot = [&](const std::string& key) {
+        ConfigLayer layer = ConfigLayer::None;
+        const ConfigValue* value = ResolveConfigVariable(key, &layer);
+        if (value && (layer == ConfigLayer::Map || layer == ConfigLayer::Runtime)) before.emplace(key, *value);
+    };
+    for (const auto& entry : m_mapConfig) snapshot(entry.first);
+    for (const auto& entry : incoming) snapshot(entry.first);
+
+    std::unordered_map<std::string, ConfigValue> previous = std::move(m_mapConfig);
+    m_mapConfig.clear();
+    ++m_configGeneration;
+    for (const auto& entry : incoming) {
+        // The map config is authoritative at map start
+        m_runtimeConfig.erase(entry.first);
+        const bool droppedPending = DropPendingValue(entry.first);
+
+        auto beforeIt = before.find(entry.first);
+        if (!droppedPending && beforeIt != before.end() && ConfigValuesEqual(beforeIt->second, entry.second)) {
+            m_mapConfig.emplace(entry.first, entry.second);
+            ++result.unchanged;
+            continue;
+        }
+        if (SubmitConfigVariable(entry.first, entry.second)) {
+            m_mapConfig.emplace(entry.first, entry.second);
+            ++result.applied;
+        } else {
+            ++result.failed;
+        }
     }
-    
-    return true;
+
+    // Options only the previous map set go back to whatever the lower layers say
+    std::vector<std::pair<std::string, ConfigValue>> dropped(previous.begin(), previous.end());
+    std::sort(dropped.begin(), dropped.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (const auto& entry : dropped) {
+        if (m_mapConfig.count(entry.first) || m_runtimeConfig.count(entry.first)) continue;
+
+        const ConfigValue* fallback = ResolveConfigVariable(entry.first, nullptr);
+        if (!fallback || ConfigValuesEqual(*fallback, entry.second)) continue;
+        if (SubmitConfigVariable(entry.first, *fallback)) {
+            ++result.restored;
+        }
+    }
+
+    Msg("[ConfigManager] Map config: %zu applied, %zu unchanged, %zu restored, %zu failed\n",
+        result.applied, result.unchanged, result.restored, result.failed);
+    return result;
+}
+
+void ConfigManager::BeginTransaction() {
+    ++m_transactionDepth;
 }
 
-std::string ConfigManager::FindGameDirectory() const {
-    // Get the path to the current DLL (which should be in bin/win64/)
-    HMODULE hModule = GetModuleHandle(nullptr);
-    if (!hModule) {
-        hModule = GetModuleHandle("stdshader_dx6.dll"); // this can be any dll in the executable directory
+size_t ConfigManager::CommitTransaction() {
+    if (m_transactionDepth == 0) {
+        Warning("[ConfigManager] CommitTransaction without BeginTransaction\n");
+        return 0;
     }
-    
-    if (!hModule) {
-        return "";
+    if (--m_transactionDepth > 0) {
+        return 0;
     }
-    
-    char dllPath[MAX_PATH];
-    if (GetModuleFileName(hModule, dllPath, sizeof(dllPath)) == 0) {
-        return "";
+
+    // Only the final value of each option, and only if it differs from what Remix holds
+    std::map<std::string, ConfigValue> changed;
+    for (auto& entry : m_stagedConfig) {
+        if (IsKnownCurrent(entry.first, entry.second)) continue;
+        changed.emplace(entry.first, std::move(entry.second));
     }
-    
-    // Convert to filesystem path
-    std::filesystem::path path(dllPath);
-    
-    // Navigate from bin/win64/ to the game root
-    // Expected structure: GameRoot/bin/win64/stdshader_dx6.dll
-    auto gameRoot = path.parent_path().parent_path().parent_path();
-    
-    return gameRoot.string();
+    m_stagedConfig.clear();
+    if (changed.empty()) {
+        return 0;
+    }
+
+    if (!m_presentCallbackActive) {
+        size_t applied = 0;
+        for (auto& entry : changed) {
+            if (!SubmitConfigVariable(entry.first, entry.second)) continue;
+            m_runtimeConfig[entry.first] = std::move(entry.second);
+            ++applied;
+        }
+        if (applied > 0) ++m_configGeneration;
+        return applied;
+    }
+
+    // The runtime layer takes the values now so reads made before the next frame already see
+    // them; any the present callback fails to submit are rolled back by ReconcilePendingFailures
+    for (const auto& entry : changed) {
+        m_runtimeConfig[entry.first] = entry.second;
+    }
+    ++m_configGeneration;
+
+    const size_t queued = changed.size();
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+    for (auto& entry : changed) {
+        m_pendingConfig.insert_or_assign(entry.first, std::move(entry.second));
+    }
+    return queued;
+}
+
+void ConfigManager::CancelTransaction() {
+    if (m_transactionDepth == 0) return;
+    m_transactionDepth = 0;
+    m_stagedConfig.clear();
+}
+
+bool ConfigManager::DropPendingValue(const std::string& key) {
+    if (!m_presentCallbackActive) return false;
+    // Waits out a present callback that is submitting, so a direct set always lands after it
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+    return m_pendingConfig.erase(key) != 0;
 }
 
-std::string ConfigManager::FindRtxConfPath() const {
-    std::string gameDir = FindGameDirectory();
-    if (gameDir.empty()) {
-        return "";
+void ConfigManager::ApplyPendingAtPresent() {
+    // Held while submitting so a set on the game thread can't reach Remix before a stale
+    // pending value does
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+    if (m_pendingConfig.empty()) return;
+
+    // Sorted by key, like every other batch
+    for (const auto& entry : m_pendingConfig) {
+        if (!SubmitConfigVariable(entry.first, entry.second)) {
+            m_pendingFailures.emplace_back(entry.first, entry.second);
+        }
+    }
+    m_pendingConfig.clear();
+    if (!m_pendingFailures.empty()) {
+        m_hasPendingFailures = true;
     }
-    
-    // RTX config is typically in the game root directory
-    std::filesystem::path confPath = std::filesystem::path(gameDir) / "rtx.conf";
-    return confPath.string();
 }
 
-std::unordered_map<std::string, std::string> ConfigManager::ParseConfigFile(const std::string& filePath) const {
-    std::unordered_map<std::string, std::string> config;
-    
-    std::ifstream file(filePath);
-    if (!file.is_open()) {
-        Msg("[ConfigManager] Could not open config file: %s\n", filePath.c_str());
+void ConfigManager::ReconcilePendingFailures() {
+    if (!m_hasPendingFailures) return;
+
+    std::vector<std::pair<std::string, ConfigValue>> failures;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        failures.swap(m_pendingFailures);
+        m_hasPendingFailures = false;
+    }
+
+    // Remix never took these, so the runtime layer must stop claiming it did. Values set
+    // again since then are left alone.
+    for (const auto& entry : failures) {
+        auto it = m_runtimeConfig.find(entry.first);
+        if (it != m_runtimeConfig.end() && ConfigValuesEqual(it->second, entry.second)) {
+            m_runtimeConfig.erase(it);
+            ++m_configGeneration;
+        }
+    }
+}
+
+// Map names come from Lua; anything that could leave the config directory is refused
+static bool IsValidMapConfigName(const std::string& mapName) {
+    return !mapName.empty()
+        && mapName.find_first_of("/\\:") == std::string::npos
+        && mapName.find("..") == std::string::npos;
+}
+
+static std::string GetMapConfigPath(const std::string& name) {
+    return WorldAPI::GetDataPath("remix_map_configs/" + name + ".txt");
+}
+
+MapConfigFile ConfigManager::ReadMapConfigs(const std::string& mapPath, const std::string& defaultPath) {
+    // Runs on the prefetch thread: touches nothing but the two files
+    MapConfigFile config;
+    if (!mapPath.empty() && ReadMapConfigFile(mapPath, config) && !config.Empty()) {
         return config;
     }
-    
-    std::string line;
-    while (std::getline(file, line)) {
-        // Skip empty lines and comments
-        if (line.empty() || line[0] == '#' || line[0] == ';') {
-            continue;
+
+    config = MapConfigFile {};
+    if (!defaultPath.empty()) {
+        ReadMapConfigFile(defaultPath, config);
+    }
+    if (config.Empty()) {
+        config.path.clear();
+    }
+    return config;
+}
+
+void ConfigManager::PrefetchMapConfig(const std::string& mapName) {
+    if (!IsValidMapConfigName(mapName)) return;
+    if (m_prefetch.valid() && m_prefetchMap == mapName) return;
+
+    const std::string mapPath = GetMapConfigPath(mapName);
+    const std::string defaultPath = GetMapConfigPath("default");
+    try {
+        // Replacing a prefetch for another map waits for it; they're a couple of small reads
+        m_prefetch = std::async(std::launch::async, &ConfigManager::ReadMapConfigs, mapPath, defaultPath);
+        m_prefetchMap = mapName;
+    } catch (const std::system_error& e) {
+        // No thread to spare: LoadMapConfig reads the files itself
+        Warning("[ConfigManager] Could not prefetch map config for %s: %s\n", mapName.c_str(), e.what());
+        m_prefetchMap.clear();
+    }
+}
+
+bool ConfigManager::LoadMapConfig(const std::string& mapName, LoadedMapConfig& out) {
+    if (!IsValidMapConfigName(mapName)) return false;
+
+    MapConfigFile config;
+    if (m_prefetch.valid() && m_prefetchMap == mapName) {
+        config = m_prefetch.get();
+    } else {
+        config = ReadMapConfigs(GetMapConfigPath(mapName), GetMapConfigPath("default"));
+    }
+    m_prefetchMap.clear();
+
+    if (config.Empty()) {
+        return false;
+    }
+
+    out.path = std::move(config.path);
+    out.rtx = ApplyMapConfig(config.rtx);
+    out.source = std::move(config.source);
+    return true;
+}
+
+const std::vector<uint64_t>* ConfigManager::GetTextureCategory(const std::string& key) {
+    if (!IsTextureListKey(key)) return nullptr;
+
+    // The mirror check is throttled, so a current index costs one lookup
+    ReconcilePendingFailures();
+    RefreshConfigMirror(false);
+    TextureCategory& category = m_textureCategories[key];
+    if (category.built && category.generation == m_configGeneration) {
+        return &category.sorted;
+    }
+
+    category.sorted.clear();
+    if (const ConfigValue* value = ResolveConfigVariable(key, nullptr)) {
+        AppendTextureHashes(value->text, category.sorted);
+        std::sort(category.sorted.begin(), category.sorted.end());
+        category.sorted.erase(std::unique(category.sorted.begin(), category.sorted.end()), category.sorted.end());
+    }
+    category.generation = m_configGeneration;
+    category.built = true;
+    return &category.sorted;
+}
+
+bool ConfigManager::IsTextureInCategory(const std::string& key, uint64_t hash) {
+    const std::vector<uint64_t>* hashes = GetTextureCategory(key);
+    return hashes && std::binary_search(hashes->begin(), hashes->end(), hash);
+}
+
+size_t ConfigManager::GetTextureCategorySize(const std::string& key) {
+    const std::vector<uint64_t>* hashes = GetTextureCategory(key);
+    return hashes ? hashes->size() : 0;
+}
+
+bool ConfigManager::EditTextureCategory(const std::string& key, const std::vector<uint64_t>& add, const std::vector<uint64_t>& remove, TextureCategoryEdit& result) {
+    result = TextureCategoryEdit {};
+    if (!IsTextureListKey(key)) {
+        Warning("[ConfigManager] %s is not a texture list option\n", key.c_str());
+        return false;
+    }
+
+    // A transaction may already have staged this list; build on that so edits don't undo each other
+    const ConfigValue* current = nullptr;
+    auto staged = m_stagedConfig.find(key);
+    if (m_transactionDepth > 0 && staged != m_stagedConfig.end()) {
+        current = &staged->second;
+    } else {
+        current = ResolveConfigVariable(key, nullptr);
+    }
+
+    // Removals first, then additions, so a hash in both ends up in the list
+    TextureHashList list;
+    if (current) {
+        std::vector<uint64_t> hashes;
+        AppendTextureHashes(current->text, hashes);
+        const std::unordered_set<uint64_t> removeSet(remove.begin(), remove.end());
+        std::unordered_set<uint64_t> dropped;
+        for (uint64_t hash : hashes) {
+            if (!removeSet.count(hash)) {
+                list.Add(hash);
+            } else if (dropped.insert(hash).second) {
+                ++result.removed;
+            }
         }
-        
-        // Find the equals sign
-        size_t equalPos = line.find('=');
-        if (equalPos == std::string::npos) {
-            continue;
+    }
+    for (uint64_t hash : add) {
+        if (list.Add(hash)) ++result.added;
+    }
+
+    if (result.added == 0 && result.removed == 0) {
+        return true;
+    }
+    return SetConfigValue(key, ConfigValue::String(list.ToString()));
+}
+
+bool ConfigManager::MergeTextureFile(const std::string& dataPath, ConfigBatchResult& result) {
+    if (dataPath.empty() || dataPath.find("..") != std::string::npos
+        || dataPath.find(':') != std::string::npos || dataPath[0] == '/' || dataPath[0] == '\\') {
+        return false;
+    }
+
+    TextureListSet incoming;
+    if (!incoming.MergeFile(WorldAPI::GetDataPath(dataPath))) {
+        Warning("[ConfigManager] Could not read texture lists from data/%s\n", dataPath.c_str());
+        return false;
+    }
+
+    std::vector<std::pair<std::string, ConfigValue>> batch;
+    for (const auto& entry : incoming.Lists()) {
+        TextureHashList merged;
+        if (const ConfigValue* current = GetConfigValue(entry.first)) {
+            merged.AddText(current->text);
         }
-        
-        std::string key = line.substr(0, equalPos);
-        std::string value = line.substr(equalPos + 1);
-        
-        // Trim whitespace
-        key.erase(0, key.find_first_not_of(" \t"));
-        key.erase(key.find_last_not_of(" \t") + 1);
-        value.erase(0, value.find_first_not_of(" \t"));
-        value.erase(value.find_last_not_of(" \t") + 1);
-        
-        // Remove quotes if present
-        if (value.length() >= 2 && value[0] == '"' && value[value.length()-1] == '"') {
-            value = value.substr(1, value.length()-2);
+
+        size_t added = 0;
+        for (uint64_t hash : entry.second.Hashes()) {
+            if (merged.Add(hash)) ++added;
+        }
+        if (added > 0) {
+            batch.emplace_back(entry.first, ConfigValue::String(merged.ToString()));
         }
-        
-        config[key] = value;
     }
-    
-    Msg("[ConfigManager] Parsed %zu config entries from %s\n", config.size(), filePath.c_str());
-    return config;
+
+    result = SetConfigVariables(batch);
+    result.skipped += incoming.Lists().size() - batch.size();
+    return true;
 }
 
-std::string ConfigManager::GetDefaultValueFromRtxOptions(const std::string& key) const {
-    // Look up the exact default value from the extracted RTX options defaults
-    auto it = RTX_OPTION_DEFAULTS.find(key);
-    if (it != RTX_OPTION_DEFAULTS.end()) {
-        return it->second;
+bool ConfigManager::ReloadConfigFile() {
+    RefreshConfigMirror(true);
+    return m_confStamped;
+}
+
+void ConfigManager::RefreshConfigMirror(bool force) {
+    // Settings menus read dozens of keys per frame; one stat per interval is plenty to notice
+    // Remix or the user rewriting the file
+    static constexpr auto CONFIG_STAT_INTERVAL = std::chrono::milliseconds(500);
+    
+    const auto now = std::chrono::steady_clock::now();
+    if (!force && m_confPathResolved && now - m_lastConfStat < CONFIG_STAT_INTERVAL) {
+        return;
     }
+    m_lastConfStat = now;
     
-    // Fallback for unknown keys - use pattern-based guessing as last resort
-    if (key.find("enable") != std::string::npos || key.find("Enable") != std::string::npos) {
-        return "True";
+    // The game directory doesn't move while we're loaded
+    if (!m_confPathResolved) {
+        // rtx.conf sits in the game root, next to garrysmod/ and bin/
+        const std::string& gameDir = WorldAPI::FindGameDirectory();
+        m_confPath = gameDir.empty() ? std::string() : (std::filesystem::path(gameDir) / "rtx.conf").string();
+        m_confPathResolved = true;
     }
-    if (key.find("Color") != std::string::npos || key.find("Albedo") != std::string::npos) {
-        return "1.0, 1.0, 1.0";
+    
+    std::error_code ec;
+    const auto writeTime = m_confPath.empty() ? std::filesystem::file_time_type {} : std::filesystem::last_write_time(m_confPath, ec);
+    const uintmax_t size = ec || m_confPath.empty() ? 0 : std::filesystem::file_size(m_confPath, ec);
+    if (m_confPath.empty() || ec) {
+        // Missing or unreadable file: nothing to serve
+        if (!m_fileConfig.empty()) {
+            m_fileConfig.clear();
+            ++m_configGeneration;
+        }
+        m_confStamped = false;
+        return;
     }
-    if (key.find("Scale") != std::string::npos || key.find("Factor") != std::string::npos) {
-        return "1.0";
+    
+    if (!force && m_confStamped && writeTime == m_confWriteTime && size == m_confSize) {
+        return;
     }
     
-    return "1.0"; // Ultimate fallback
+    m_fileConfig.clear();
+    ++m_configGeneration;
+    if (size > 0 && !ParseConfigFile(m_confPath, m_fileConfig)) {
+        Msg("[ConfigManager] Could not open config file: %s\n", m_confPath.c_str());
+    }
+    m_confWriteTime = writeTime;
+    m_confSize = size;
+    m_confStamped = true;
 }
 
-std::string ConfigManager::ExtractDefaultFromPattern(const std::string& line, const std::string& key) const {
-    // This method could be enhanced to parse actual RTX_OPTION declarations from rtx_options.h
-    // For now, just return the pattern-based default
-    return GetDefaultValueFromRtxOptions(key);
+remix::UIState ConfigManager::GetUIState() {
+    if (!m_remixInterface) return remix::UIState::None;
+
+    auto result = m_remixInterface->GetUIState();
+    if (!result) {
+        Error("[ConfigManager] Failed to get UI state: %d\n", result.status());
+        return remix::UIState::None;
+    }
+    
+    return result.value();
+}
+
+bool ConfigManager::SetUIState(remix::UIState state) {
+    if (!m_remixInterface) return false;
+
+    auto result = m_remixInterface->SetUIState(state);
+    if (!result) {
+        Error("[ConfigManager] Failed to set UI state: %d\n", result.status());
+        return false;
+    }
+    
+    return true;
+}
+
+bool ConfigManager::ParseConfigFile(const std::string& filePath, std::unordered_map<std::string, ConfigValue>& config) const {
+    // Streamed straight out of the mapped file; the only copies made are the stored keys and
+    // values. Each value is parsed into its typed form once, and text that doesn't fit an
+    // option's type is kept as a string so reads still return what the file says.
+    const bool opened = VisitConfigFile(filePath, [&](std::string_view key, std::string_view text) {
+        ConfigValue value;
+        if (!ParseConfigValue(GetConfigSchema(key), text, value)) {
+            value = ConfigValue::String(text);
+        }
+        config.insert_or_assign(std::string(key), std::move(value));
+    });
+    if (!opened) {
+        return false;
+    }
+    
+    Msg("[ConfigManager] Parsed %zu config entries from %s\n", config.size(), filePath.c_str());
+    return true;
 }
 
 //=============================================================================
@@ -2,6 +2,9 @@
 
 #pragma once
 #include "GarrysMod/Lua/Interface.h"
+#include "config_schema.h"
+#include "map_config.h"
+#include "texture_lists.h"
 
 #include <Windows.h>
 #include <d3d9.h>
@@ -10,6 +13,12 @@
 #include <remix/remix_c.h>
 
 #include <unordered_map>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -51,6 +60,9 @@ namespace RemixAPI {
         void EndFrame();
         void Present();
         
+        // Called from Remix's present callback, on Remix's thread
+        void OnPresentCallback();
+        
     private:
         RemixAPI();
         ~RemixAPI();
@@ -67,6 +79,10 @@ namespace RemixAPI {
         std::unique_ptr<LightManager> m_lightManager;
         
         bool m_initialized;
+        
+        // What the present callback may use; set after Initialize, cleared first thing in Shutdown
+        std::mutex m_presentMutex;
+        ConfigManager* m_presentConfigManager = nullptr;
     };
 
     // Light Management
@@ -83,6 +99,14 @@ namespace RemixAPI {
         uint64_t CreateCylinderLight(const remix::LightInfo& base, const remix::LightInfoCylinderEXT& ext, uint64_t entityId);
         uint64_t CreateDomeLight(const remix::LightInfo& base, const remix::LightInfoDomeEXT& ext, uint64_t entityId);
 
+        // Creates many sphere lights under one lock; ids line up with the requests (0 = failed)
+        struct SphereLightRequest {
+            remix::LightInfo base;
+            remix::LightInfoSphereEXT sphere;
+            uint64_t entityId { 0 };
+        };
+        std::vector<uint64_t> CreateSphereLights(const std::vector<SphereLightRequest>& requests);
+
         // Update existing light definition (hash preserved)
         bool UpdateSphereLight(uint64_t lightId, const remix::LightInfo& base, const remix::LightInfoSphereEXT& ext);
         bool UpdateRectLight(uint64_t lightId, const remix::LightInfo& base, const remix::LightInfoRectEXT& ext);
@@ -226,14 +250,94 @@ namespace RemixAPI {
     };
 
     // Configuration Management
+    // Remix can't read options back, so ConfigManager tracks what each option should be in
+    // layers, lowest first: RTX_OPTION_DEFAULTS, rtx.conf, the map config, runtime sets.
+    enum class ConfigLayer {
+        None,
+        Default,
+        File,
+        Map,
+        Runtime
+    };
+
     class ConfigManager {
     public:
         ConfigManager(remix::Interface* remixInterface, GarrysMod::Lua::ILuaBase* LUA);
         ~ConfigManager();
         
-        // Config variables
+        // Config variables. Values are parsed against the option schema, clamped to its range and
+        // recorded in the runtime layer once Remix took them; setting the value the map or runtime
+        // layer already holds is skipped without calling into Remix.
         bool SetConfigVariable(const std::string& key, const std::string& value);
+        bool SetConfigValue(const std::string& key, ConfigValue value);
         std::string GetConfigVariable(const std::string& key);
+        const ConfigValue* GetConfigValue(const std::string& key);
+        ConfigLayer GetConfigLayer(const std::string& key);
+        
+        // Applies a batch in one pass: values are parsed and clamped, keys sorted so the order is
+        // deterministic, and sets equal to the known current value are skipped.
+        struct ConfigBatchResult {
+            size_t applied = 0;
+            size_t skipped = 0;
+            size_t failed = 0;
+        };
+        ConfigBatchResult SetConfigVariables(const std::vector<std::pair<std::string, ConfigValue>>& values);
+        
+        // Replaces the map layer. Options that already hold the same value we sent earlier are
+        // skipped, everything else is sent to Remix; options the previous map set and this one
+        // doesn't fall back to rtx.conf/defaults. Runtime overrides of options the new map sets
+        // are dropped.
+        struct MapConfigResult {
+            size_t applied = 0;
+            size_t unchanged = 0;
+            size_t failed = 0;
+            size_t restored = 0;
+        };
+        MapConfigResult ApplyMapConfig(const std::vector<std::pair<std::string, ConfigValue>>& values);
+        
+        // Transactions: between BeginTransaction and the matching CommitTransaction sets are
+        // staged and coalesced per key instead of reaching Remix. Commit queues the values that
+        // changed for the next present callback so they land together at a frame boundary, or
+        // applies them at once when no present callback is registered. Returns how many were
+        // queued, or how many Remix took when applied at once.
+        void BeginTransaction();
+        size_t CommitTransaction();
+        void CancelTransaction();
+        bool IsInTransaction() const { return m_transactionDepth > 0; }
+        
+        void SetPresentCallbackActive(bool active) { m_presentCallbackActive = active; }
+        void ApplyPendingAtPresent();
+        
+        // Per-map configs from data/remix_map_configs/, falling back to default.txt when the map
+        // has none. Prefetch reads and parses the files on a worker thread (call it while the map
+        // loads); LoadMapConfig waits for that read if it's for the same map, applies the Remix
+        // options as the map layer and hands back the Source cvars, which only Lua can run.
+        struct LoadedMapConfig {
+            std::string path;
+            MapConfigResult rtx;
+            std::vector<std::pair<std::string, std::string>> source;
+        };
+        void PrefetchMapConfig(const std::string& mapName);
+        bool LoadMapConfig(const std::string& mapName, LoadedMapConfig& out);
+        
+        // Texture categories: the hash lists of rtx.*Texture(s) options, indexed as sorted hashes
+        // that are rebuilt lazily after the option changed. Edits start from the option's current
+        // (or staged) list, keep its order and set the option once.
+        struct TextureCategoryEdit {
+            size_t added = 0;
+            size_t removed = 0;
+        };
+        bool IsTextureInCategory(const std::string& key, uint64_t hash);
+        size_t GetTextureCategorySize(const std::string& key);
+        bool EditTextureCategory(const std::string& key, const std::vector<uint64_t>& add, const std::vector<uint64_t>& remove, TextureCategoryEdit& result);
+        
+        // Unions the texture lists of a config file (path inside garrysmod/data/) into the current
+        // values, keeping their order and appending only hashes they don't hold yet. Every changed
+        // list is set once. Returns false if the file can't be read.
+        bool MergeTextureFile(const std::string& dataPath, ConfigBatchResult& result);
+        
+        // Drops the rtx.conf mirror and re-reads the file now. Returns false if it could not be read.
+        bool ReloadConfigFile();
         
         // UI State
         remix::UIState GetUIState();
@@ -246,12 +350,57 @@ namespace RemixAPI {
         remix::Interface* m_remixInterface;
         GarrysMod::Lua::ILuaBase* m_lua;
         
+        // Parsed copy of rtx.conf. Reads are served from here; the file is stat'ed at most once
+        // per CONFIG_STAT_INTERVAL and only re-parsed when its write time or size changed.
+        std::unordered_map<std::string, ConfigValue> m_fileConfig;
+        std::string m_confPath;
+        bool m_confPathResolved = false;
+        bool m_confStamped = false;
+        std::filesystem::file_time_type m_confWriteTime {};
+        uintmax_t m_confSize = 0;
+        std::chrono::steady_clock::time_point m_lastConfStat {};
+        
+        std::unordered_map<std::string, ConfigValue> m_mapConfig;
+        std::unordered_map<std::string, ConfigValue> m_runtimeConfig;
+        std::unordered_map<std::string, ConfigValue> m_defaultConfig;
+        
+        // Bumped whenever a layer changes; derived caches compare against it
+        uint64_t m_configGeneration = 0;
+        
+        struct TextureCategory {
+            uint64_t generation = 0;
+            bool built = false;
+            std::vector<uint64_t> sorted;
+        };
+        std::unordered_map<std::string, TextureCategory> m_textureCategories;
+        
+        int m_transactionDepth = 0;
+        std::map<std::string, ConfigValue> m_stagedConfig;
+        
+        // Committed values waiting for the present callback, and those it failed to submit; the
+        // only state that thread touches
+        std::mutex m_pendingMutex;
+        std::map<std::string, ConfigValue> m_pendingConfig;
+        std::vector<std::pair<std::string, ConfigValue>> m_pendingFailures;
+        std::atomic<bool> m_hasPendingFailures { false };
+        std::atomic<bool> m_presentCallbackActive { false };
+        
+        std::string m_prefetchMap;
+        std::future<MapConfigFile> m_prefetch;
+        
+        void RefreshConfigMirror(bool force);
+        const ConfigValue* ResolveConfigVariable(const std::string& key, ConfigLayer* layer);
+        bool SubmitConfigVariable(const std::string& key, const ConfigValue& value);
+        bool PrepareConfigValue(const std::string& key, ConfigValue& value) const;
+        std::vector<std::pair<std::string, ConfigValue>> PrepareConfigBatch(const std::vector<std::pair<std::string, ConfigValue>>& values, size_t& rejected) const;
+        bool IsKnownCurrent(const std::string& key, const ConfigValue& value);
+        bool DropPendingValue(const std::string& key);
+        void ReconcilePendingFailures();
+        const std::vector<uint64_t>* GetTextureCategory(const std::string& key);
+        
         // Config file parsing
-        std::string FindGameDirectory() const;
-        std::string FindRtxConfPath() const;
-        std::unordered_map<std::string, std::string> ParseConfigFile(const std::string& filePath) const;
-        std::string GetDefaultValueFromRtxOptions(const std::string& key) const;
-        std::string ExtractDefaultFromPattern(const std::string& line, const std::string& key) const;
+        bool ParseConfigFile(const std::string& filePath, std::unordered_map<std::string, ConfigValue>& config) const;
+        static MapConfigFile ReadMapConfigs(const std::string& mapPath, const std::string& defaultPath);
     };
 
     // Resource Management
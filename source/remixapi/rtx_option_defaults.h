@@ -1,13 +1,138 @@
 #pragma once
 
-#include <unordered_map>
-#include <string>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
 
 namespace RemixAPI {
 
+enum class RtxOptionType : uint8_t {
+    Bool,
+    Int,
+    Float,
+    Vector,   // "a, b[, c]", count components in values
+    String
+};
+
+struct RtxOptionDefault {
+    std::string_view key;
+    std::string_view text;   // default as Remix spells it in rtx.conf
+    RtxOptionType type = RtxOptionType::String;
+    uint8_t count = 0;       // numeric components in values
+    double values[3] = { 0.0, 0.0, 0.0 };
+
+    constexpr bool AsBool() const { return values[0] != 0.0; }
+    constexpr double AsNumber() const { return values[0]; }
+};
+
+namespace detail {
+    struct RtxOptionText {
+        std::string_view key;
+        std::string_view text;
+    };
+
+    constexpr std::string_view TrimRtxText(std::string_view text) {
+        while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) text.remove_prefix(1);
+        while (!text.empty() && (text.back() == ' ' || text.back() == '\t')) text.remove_suffix(1);
+        return text;
+    }
+
+    // Plain decimal literal ("-12", "0.85", "4294967295"); sets isInteger when there's no '.'
+    constexpr bool ParseRtxNumber(std::string_view text, double& out, bool& isInteger) {
+        text = TrimRtxText(text);
+        if (text.empty()) return false;
+
+        bool negative = false;
+        if (text.front() == '-' || text.front() == '+') {
+            negative = text.front() == '-';
+            text.remove_prefix(1);
+        }
+
+        double mantissa = 0.0;
+        double scale = 1.0;
+        bool digits = false;
+        bool fraction = false;
+        for (char c : text) {
+            if (c >= '0' && c <= '9') {
+                mantissa = mantissa * 10.0 + (c - '0');
+                if (fraction) scale *= 10.0;
+                digits = true;
+            } else if (c == '.' && !fraction) {
+                fraction = true;
+            } else {
+                return false;
+            }
+        }
+        if (!digits) return false;
+
+        out = (negative ? -mantissa : mantissa) / scale;
+        isInteger = !fraction;
+        return true;
+    }
+
+    constexpr RtxOptionDefault MakeRtxOptionDefault(const RtxOptionText& entry) {
+        RtxOptionDefault option {};
+        option.key = entry.key;
+        option.text = entry.text;
+
+        if (entry.text == "True" || entry.text == "False") {
+            option.type = RtxOptionType::Bool;
+            option.count = 1;
+            option.values[0] = entry.text == "True" ? 1.0 : 0.0;
+            return option;
+        }
+
+        // Split on commas; anything that isn't all numbers stays a string
+        std::string_view rest = entry.text;
+        bool allIntegers = true;
+        uint8_t count = 0;
+        double values[3] = { 0.0, 0.0, 0.0 };
+        while (true) {
+            const size_t comma = rest.find(',');
+            const std::string_view part = rest.substr(0, comma);
+            double value = 0.0;
+            bool isInteger = false;
+            if (count == 3 || !ParseRtxNumber(part, value, isInteger)) return option;
+            values[count++] = value;
+            allIntegers = allIntegers && isInteger;
+            if (comma == std::string_view::npos) break;
+            rest.remove_prefix(comma + 1);
+        }
+
+        option.count = count;
+        for (uint8_t i = 0; i < count; ++i) option.values[i] = values[i];
+        option.type = count > 1 ? RtxOptionType::Vector : (allIntegers ? RtxOptionType::Int : RtxOptionType::Float);
+        return option;
+    }
+
+    // Typed entries sorted by key (bottom-up merge sort, stable so the first of any duplicate
+    // keys wins like it did in the old unordered_map)
+    template <size_t N>
+    constexpr std::array<RtxOptionDefault, N> BuildRtxOptionTable(const RtxOptionText (&entries)[N]) {
+        std::array<RtxOptionDefault, N> sorted {};
+        std::array<RtxOptionDefault, N> scratch {};
+        for (size_t i = 0; i < N; ++i) sorted[i] = MakeRtxOptionDefault(entries[i]);
+
+        for (size_t width = 1; width < N; width *= 2) {
+            for (size_t left = 0; left < N; left += 2 * width) {
+                const size_t mid = left + width < N ? left + width : N;
+                const size_t right = left + 2 * width < N ? left + 2 * width : N;
+                size_t a = left, b = mid, out = left;
+                while (a < mid && b < right) scratch[out++] = sorted[b].key < sorted[a].key ? sorted[b++] : sorted[a++];
+                while (a < mid) scratch[out++] = sorted[a++];
+                while (b < right) scratch[out++] = sorted[b++];
+            }
+            for (size_t i = 0; i < N; ++i) sorted[i] = scratch[i];
+        }
+        return sorted;
+    }
+
+} // namespace detail
+
 // Some RTX Option defaults extracted from public/include/remix/rtx_options.h
 // This table contains the default values from each RTX_OPTION declaration
-inline const std::unordered_map<std::string, std::string> RTX_OPTION_DEFAULTS = {
+inline constexpr detail::RtxOptionText RTX_OPTION_DEFAULT_TEXT[] = {
     // Core RTX settings
     {"rtx.showRaytracingOption", "True"},
     {"rtx.enableRaytracing", "True"},
@@ -458,4 +583,32 @@ inline const std::unordered_map<std::string, std::string> RTX_OPTION_DEFAULTS =
     {"rtx.enableFog", "False"}
 };
 
-} // namespace RemixAPI 
\ No newline at end of file
+// Built at compile time: no allocation during static init, lookups are a binary search
+inline constexpr auto RTX_OPTION_DEFAULTS = detail::BuildRtxOptionTable(RTX_OPTION_DEFAULT_TEXT);
+
+constexpr const RtxOptionDefault* FindRtxOptionDefault(std::string_view key) {
+    size_t low = 0;
+    size_t high = RTX_OPTION_DEFAULTS.size();
+    while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        if (RTX_OPTION_DEFAULTS[mid].key < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low < RTX_OPTION_DEFAULTS.size() && RTX_OPTION_DEFAULTS[low].key == key ? &RTX_OPTION_DEFAULTS[low] : nullptr;
+}
+
+namespace detail {
+    constexpr bool IsRtxOptionTableSorted() {
+        for (size_t i = 1; i < RTX_OPTION_DEFAULTS.size(); ++i) {
+            if (!(RTX_OPTION_DEFAULTS[i - 1].key < RTX_OPTION_DEFAULTS[i].key)) return false;
+        }
+        return true;
+    }
+}
+
+static_assert(detail::IsRtxOptionTableSorted(), "RTX option defaults must be unique and sorted by key");
+
+} // namespace RemixAPI
@@ -0,0 +1,210 @@
+#include "texture_lists.h"
+#include "config_parser.h"
+
+#include <algorithm>
+
+namespace RemixAPI {
+
+namespace {
+
+    int HexDigitValue(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        return -1;
+    }
+
+    // Calls visit(hash) for each "0x..." token in value, in order. Tokens too long for 64 bits
+    // are skipped.
+    template <typename Visitor>
+    size_t ForEachTextureHash(std::string_view value, Visitor&& visit) {
+        size_t count = 0;
+        size_t i = 0;
+        while (i < value.size()) {
+            const size_t start = value.find("0x", i);
+            if (start == std::string_view::npos) break;
+
+            size_t end = start + 2;
+            while (end < value.size() && HexDigitValue(value[end]) >= 0) ++end;
+
+            uint64_t hash = 0;
+            if (ParseTextureHash(value.substr(start, end - start), hash)) {
+                visit(hash);
+                ++count;
+            }
+            i = end;
+        }
+        return count;
+    }
+
+    void AppendTextureHash(std::string& out, uint64_t hash) {
+        static constexpr char HEX_DIGITS[] = "0123456789ABCDEF";
+        char buffer[18] = { '0', 'x' };
+        for (int digit = 0; digit < 16; ++digit) {
+            buffer[17 - digit] = HEX_DIGITS[(hash >> (digit * 4)) & 0xF];
+        }
+        out.append(buffer, sizeof(buffer));
+    }
+
+} // namespace
+
+bool IsTextureListKey(std::string_view key) {
+    if (!key.empty() && key.back() == 's') key.remove_suffix(1);
+    if (key.size() < 7) return false;
+
+    const std::string_view suffix = key.substr(key.size() - 7);
+    return (suffix[0] == 'T' || suffix[0] == 't') && suffix.substr(1) == "exture";
+}
+
+bool ParseTextureHash(std::string_view token, uint64_t& out) {
+    if (token.size() < 3 || token.size() > 18 || token[0] != '0' || token[1] != 'x') return false;
+
+    uint64_t hash = 0;
+    for (size_t i = 2; i < token.size(); ++i) {
+        const int digit = HexDigitValue(token[i]);
+        if (digit < 0) return false;
+        hash = (hash << 4) | static_cast<uint64_t>(digit);
+    }
+    out = hash;
+    return true;
+}
+
+size_t AppendTextureHashes(std::string_view value, std::vector<uint64_t>& out) {
+    return ForEachTextureHash(value, [&](uint64_t hash) { out.push_back(hash); });
+}
+
+bool TextureHashList::Add(uint64_t hash) {
+    if (!m_seen.insert(hash).second) return false;
+    m_order.push_back(hash);
+    return true;
+}
+
+bool TextureHashList::Remove(uint64_t hash) {
+    if (m_seen.erase(hash) == 0) return false;
+    m_order.erase(std::find(m_order.begin(), m_order.end(), hash));
+    return true;
+}
+
+void TextureHashList::Clear() {
+    m_order.clear();
+    m_seen.clear();
+}
+
+size_t TextureHashList::AddText(std::string_view value) {
+    size_t added = 0;
+    ForEachTextureHash(value, [&](uint64_t hash) {
+        if (Add(hash)) ++added;
+    });
+    return added;
+}
+
+std::string TextureHashList::ToString() const {
+    std::string out;
+    out.reserve(m_order.size() * 20);
+    for (size_t i = 0; i < m_order.size(); ++i) {
+        if (i > 0) out.append(", ");
+        AppendTextureHash(out, m_order[i]);
+    }
+    return out;
+}
+
+TextureHashList& TextureListSet::Get(const std::string& key) {
+    auto it = m_index.find(key);
+    if (it != m_index.end()) return m_lists[it->second].second;
+
+    m_index.emplace(key, m_lists.size());
+    m_lists.emplace_back(key, TextureHashList {});
+    return m_lists.back().second;
+}
+
+const TextureHashList* TextureListSet::Find(const std::string& key) const {
+    auto it = m_index.find(key);
+    return it != m_index.end() ? &m_lists[it->second].second : nullptr;
+}
+
+size_t TextureListSet::MergeText(std::string_view text) {
+    size_t added = 0;
+    std::string key;
+    VisitConfigText(text, [&](std::string_view lineKey, std::string_view value) {
+        if (!IsTextureListKey(lineKey) || value.find("0x") == std::string_view::npos) return;
+        key.assign(lineKey.data(), lineKey.size());
+        added += Get(key).AddText(value);
+    });
+    return added;
+}
+
+bool TextureListSet::MergeFile(const std::string& path, size_t* added) {
+    WorldAPI::MappedFile file;
+    if (!file.Open(path)) return false;
+
+    const size_t merged = MergeText(std::string_view(reinterpret_cast<const char*>(file.Data()), file.Size()));
+    if (added) *added = merged;
+    return true;
+}
+
+TextureListSet TextureListSet::Difference(const TextureListSet& other) const {
+    TextureListSet result;
+    for (const auto& entry : m_lists) {
+        const TextureHashList* exclude = other.Find(entry.first);
+        TextureHashList* target = nullptr;
+        for (uint64_t hash : entry.second.Hashes()) {
+            if (exclude && exclude->Contains(hash)) continue;
+            if (!target) target = &result.Get(entry.first);
+            target->Add(hash);
+        }
+    }
+    return result;
+}
+
+void TextureListSet::Retain(const std::vector<std::string>& keys) {
+    const std::unordered_set<std::string> keep(keys.begin(), keys.end());
+    std::vector<std::pair<std::string, TextureHashList>> lists;
+    m_index.clear();
+    for (auto& entry : m_lists) {
+        if (!keep.count(entry.first)) continue;
+        m_index.emplace(entry.first, lists.size());
+        lists.push_back(std::move(entry));
+    }
+    m_lists = std::move(lists);
+}
+
+std::string TextureListSet::ToString() const {
+    std::string out;
+    for (const auto& entry : m_lists) {
+        out.append(entry.first).append(" = ").append(entry.second.ToString()).push_back('\n');
+    }
+    return out;
+}
+
+std::string DedupeTextureLists(std::string_view text, size_t* removed) {
+    std::string out;
+    out.reserve(text.size());
+    size_t dropped = 0;
+
+    // Values are views into text, so everything between them is copied through as-is
+    const char* copied = text.data();
+    TextureHashList list;
+    VisitConfigText(text, [&](std::string_view key, std::string_view value) {
+        if (!IsTextureListKey(key)) return;
+        // Only the hashes are rewritten; a trailing comment stays where it was
+        const size_t comment = value.find('#');
+        if (comment != std::string_view::npos) value = detail::TrimConfigField(value.substr(0, comment));
+        if (value.find("0x") == std::string_view::npos) return;
+
+        list.Clear();
+        const size_t tokens = ForEachTextureHash(value, [&](uint64_t hash) { list.Add(hash); });
+        // Lists without repeats keep their original spelling
+        if (tokens == list.Size()) return;
+        dropped += tokens - list.Size();
+
+        out.append(copied, static_cast<size_t>(value.data() - copied));
+        out.append(list.ToString());
+        copied = value.data() + value.size();
+    });
+    out.append(copied, static_cast<size_t>(text.data() + text.size() - copied));
+
+    if (removed) *removed = dropped;
+    return out;
+}
+
+} // namespace RemixAPI
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace RemixAPI {
+
+    // Options holding texture hash lists ("rtx.ignoreTextures", "rtx.skyBoxTexture", ...). Flags
+    // that happen to share the suffix, such as rtx.detectUITextures, never hold hashes and are
+    // left alone by everything below.
+    bool IsTextureListKey(std::string_view key);
+
+    // One "0x..." hash of up to 16 hex digits
+    bool ParseTextureHash(std::string_view token, uint64_t& out);
+
+    // Appends every hash token of an option value to out, repeats included; returns how many
+    size_t AppendTextureHashes(std::string_view value, std::vector<uint64_t>& out);
+
+    // Texture hashes in first-seen order with constant-time membership
+    class TextureHashList {
+    public:
+        bool Add(uint64_t hash);
+        bool Remove(uint64_t hash);
+        bool Contains(uint64_t hash) const { return m_seen.count(hash) != 0; }
+        void Clear();
+
+        size_t Size() const { return m_order.size(); }
+        bool Empty() const { return m_order.empty(); }
+        const std::vector<uint64_t>& Hashes() const { return m_order; }
+
+        // Adds every hash token in an option value; anything else is ignored. Returns how many
+        // hashes were new.
+        size_t AddText(std::string_view value);
+
+        // Option value as Remix writes it: "0x%016llX, 0x%016llX, ..."
+        std::string ToString() const;
+
+    private:
+        std::vector<uint64_t> m_order;
+        std::unordered_set<uint64_t> m_seen;
+    };
+
+    // Texture lists of one or more config files by option key, keys in first-seen order
+    class TextureListSet {
+    public:
+        TextureHashList& Get(const std::string& key);
+        const TextureHashList* Find(const std::string& key) const;
+        const std::vector<std::pair<std::string, TextureHashList>>& Lists() const { return m_lists; }
+        bool Empty() const { return m_lists.empty(); }
+
+        // Unions every texture list in the text (or file) into this set. Lines without a
+        // single hash don't create a key. Returns how many hashes were new.
+        size_t MergeText(std::string_view text);
+        bool MergeFile(const std::string& path, size_t* added = nullptr);
+
+        // Hashes of this set missing from other, per key, in this set's order; empty lists are dropped
+        TextureListSet Difference(const TextureListSet& other) const;
+
+        // Keeps only the given keys
+        void Retain(const std::vector<std::string>& keys);
+
+        // One "key = hashes" line per list
+        std::string ToString() const;
+
+    private:
+        std::vector<std::pair<std::string, TextureHashList>> m_lists;
+        std::unordered_map<std::string, size_t> m_index;
+    };
+
+    // Copy of config text where every texture list with repeated hashes lost them (and was
+    // re-spelled in Remix's format); all other text is copied through untouched. removed
+    // receives the number of hashes dropped.
+    std::string DedupeTextureLists(std::string_view text, size_t* removed = nullptr);
+
+} // namespace RemixAPI
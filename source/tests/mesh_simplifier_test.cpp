@@ -0,0 +1,116 @@
+// mesh_simplifier_test: checks that SimplifyMesh and BuildLODChain reach their target triangle
+// counts on meshes the world LODs see. Exits non-zero on the first failed check.
+
+#include "worldapi/mesh_simplifier.h"
+
+#include <cstdio>
+#include <vector>
+
+using namespace WorldAPI;
+
+namespace {
+
+    int g_failures = 0;
+
+    void Check(bool condition, const char* what, size_t got, size_t want) {
+        std::printf("%s %s: %zu (want %zu)\n", condition ? "ok  " : "FAIL", what, got, want);
+        if (!condition) ++g_failures;
+    }
+
+    // Flat size x size quad grid on z = 0 with one continuous UV mapping: 2 * size^2 triangles
+    IndexedMesh MakeGrid(int size) {
+        IndexedMesh mesh;
+        for (int y = 0; y <= size; ++y) {
+            for (int x = 0; x <= size; ++x) {
+                MeshVertex vertex = { { x * 16.0f, y * 16.0f, 0.0f }, { 0.0f, 0.0f, 1.0f },
+                                      { static_cast<float>(x) / size, static_cast<float>(y) / size } };
+                mesh.vertices.push_back(vertex);
+            }
+        }
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                const uint32_t a = static_cast<uint32_t>(y * (size + 1) + x);
+                const uint32_t b = a + 1;
+                const uint32_t c = a + static_cast<uint32_t>(size) + 1;
+                const uint32_t d = c + 1;
+                mesh.indices.insert(mesh.indices.end(), { a, b, d, a, d, c });
+            }
+        }
+        return mesh;
+    }
+
+    // A collapse removes two triangles, and a few may be refused for flipping one
+    bool NearTarget(size_t got, size_t want) {
+        return got + 2 >= want && got <= want + want / 20 + 2;
+    }
+
+    void TestGridRatio() {
+        const IndexedMesh grid = MakeGrid(64);
+        for (float ratio : { 0.5f, 0.25f, 0.1f }) {
+            SimplifyOptions options;
+            options.targetRatio = ratio;
+            const size_t want = static_cast<size_t>(grid.TriangleCount() * ratio);
+            const size_t got = SimplifyMesh(grid, options).TriangleCount();
+
+            char what[64];
+            std::snprintf(what, sizeof(what), "grid ratio %.2f", ratio);
+            Check(NearTarget(got, want), what, got, want);
+        }
+    }
+
+    void TestGridLockedBorders() {
+        const IndexedMesh grid = MakeGrid(64);
+        SimplifyOptions options;
+        options.targetRatio = 0.1f;
+        options.lockBorders = true;
+        const size_t want = static_cast<size_t>(grid.TriangleCount() * 0.1f);
+        const size_t got = SimplifyMesh(grid, options).TriangleCount();
+        Check(NearTarget(got, want), "grid ratio 0.10, locked borders", got, want);
+    }
+
+    void TestSeamsStayPut() {
+        const IndexedMesh grid = MakeGrid(16);
+        // The x = 0 edge meets a neighbour
+        SeamPositions seams;
+        for (const MeshVertex& vertex : grid.vertices) {
+            if (vertex.pos[0] == 0.0f) seams.Add(vertex.pos);
+        }
+
+        SimplifyOptions options;
+        options.targetRatio = 0.1f;
+        options.seams = &seams;
+        const IndexedMesh simplified = SimplifyMesh(grid, options);
+
+        size_t kept = 0;
+        for (const MeshVertex& vertex : simplified.vertices) {
+            if (vertex.pos[0] == 0.0f) ++kept;
+        }
+        Check(kept == 17, "seam vertices kept", kept, 17);
+    }
+
+    void TestLODChain() {
+        const IndexedMesh grid = MakeGrid(64);
+        const std::vector<float> ratios = { 0.5f, 0.25f, 0.125f };
+        const std::vector<IndexedMesh> chain = BuildLODChain(grid, ratios, SimplifyOptions());
+
+        Check(chain.size() == ratios.size(), "LOD levels", chain.size(), ratios.size());
+        for (size_t level = 0; level < chain.size(); ++level) {
+            const size_t want = static_cast<size_t>(grid.TriangleCount() * ratios[level]);
+            Check(NearTarget(chain[level].TriangleCount(), want), "LOD level triangles", chain[level].TriangleCount(), want);
+        }
+    }
+
+} // namespace
+
+int main() {
+    TestGridRatio();
+    TestGridLockedBorders();
+    TestSeamsStayPut();
+    TestLODChain();
+
+    if (g_failures > 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,147 @@
+// rtxconf: texture list maintenance for rtx.conf files, built on the module's config parser.
+//
+//   rtxconf merge <in>... [-o out]                  union of every texture list, first-seen order
+//   rtxconf filter <in>... [-k key]... [-o out]     texture lists only, optionally just the given keys
+//   rtxconf diff <base> <other> [-o out]            per key, hashes only in other (+) and only in base (-)
+//   rtxconf dedupe <in> [-o out]                    the file with repeated hashes dropped from each list
+//
+// Output goes to stdout unless -o is given; warnings and errors go to stderr.
+
+#include "remixapi/texture_lists.h"
+#include "worldapi/mapped_file.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+    struct Options {
+        std::string command;
+        std::vector<std::string> inputs;
+        std::vector<std::string> keys;
+        std::string output;
+    };
+
+    int PrintUsage() {
+        std::fprintf(stderr,
+            "usage: rtxconf merge <in>... [-o out]\n"
+            "       rtxconf filter <in>... [-k key]... [-o out]\n"
+            "       rtxconf diff <base> <other> [-o out]\n"
+            "       rtxconf dedupe <in> [-o out]\n");
+        return 2;
+    }
+
+    bool ParseOptions(int argc, char** argv, Options& options) {
+        if (argc < 2) return false;
+        options.command = argv[1];
+        for (int i = 2; i < argc; ++i) {
+            if (std::strcmp(argv[i], "-o") == 0 || std::strcmp(argv[i], "--output") == 0) {
+                if (++i >= argc) return false;
+                options.output = argv[i];
+            } else if (std::strcmp(argv[i], "-k") == 0 || std::strcmp(argv[i], "--key") == 0) {
+                if (++i >= argc) return false;
+                options.keys.emplace_back(argv[i]);
+            } else {
+                options.inputs.emplace_back(argv[i]);
+            }
+        }
+        return true;
+    }
+
+    bool WriteOutput(const Options& options, const std::string& text) {
+        if (options.output.empty()) {
+            std::fwrite(text.data(), 1, text.size(), stdout);
+            return true;
+        }
+
+        FILE* file = std::fopen(options.output.c_str(), "wb");
+        if (!file) {
+            std::fprintf(stderr, "Error: could not write '%s'\n", options.output.c_str());
+            return false;
+        }
+        bool written = std::fwrite(text.data(), 1, text.size(), file) == text.size();
+        written = std::fclose(file) == 0 && written;
+        if (!written) {
+            std::fprintf(stderr, "Error: could not write '%s'\n", options.output.c_str());
+        }
+        return written;
+    }
+
+    // Missing inputs are skipped with a warning, like the old scripts did
+    void MergeInputs(const std::vector<std::string>& inputs, RemixAPI::TextureListSet& lists) {
+        for (const auto& path : inputs) {
+            if (!lists.MergeFile(path)) {
+                std::fprintf(stderr, "Warning: '%s' not found or empty; skipping.\n", path.c_str());
+            }
+        }
+    }
+
+    std::string FormatDiff(const RemixAPI::TextureListSet& lists, char sign) {
+        std::string out;
+        for (const auto& entry : lists.Lists()) {
+            out.push_back(sign);
+            out.append(entry.first).append(" = ").append(entry.second.ToString()).push_back('\n');
+        }
+        return out;
+    }
+
+    int RunMerge(const Options& options) {
+        if (options.inputs.empty()) return PrintUsage();
+
+        RemixAPI::TextureListSet lists;
+        MergeInputs(options.inputs, lists);
+        if (!options.keys.empty()) {
+            lists.Retain(options.keys);
+        }
+        return WriteOutput(options, lists.ToString()) ? 0 : 1;
+    }
+
+    int RunDiff(const Options& options) {
+        if (options.inputs.size() != 2) return PrintUsage();
+
+        RemixAPI::TextureListSet base;
+        RemixAPI::TextureListSet other;
+        if (!base.MergeFile(options.inputs[0]) || !other.MergeFile(options.inputs[1])) {
+            std::fprintf(stderr, "Error: could not read '%s' or '%s'\n", options.inputs[0].c_str(), options.inputs[1].c_str());
+            return 1;
+        }
+
+        const std::string text = FormatDiff(other.Difference(base), '+') + FormatDiff(base.Difference(other), '-');
+        return WriteOutput(options, text) ? 0 : 1;
+    }
+
+    int RunDedupe(const Options& options) {
+        if (options.inputs.size() != 1) return PrintUsage();
+
+        WorldAPI::MappedFile file;
+        if (!file.Open(options.inputs[0])) {
+            std::fprintf(stderr, "Error: could not read '%s'\n", options.inputs[0].c_str());
+            return 1;
+        }
+
+        size_t removed = 0;
+        const std::string text = RemixAPI::DedupeTextureLists(
+            std::string_view(reinterpret_cast<const char*>(file.Data()), file.Size()), &removed);
+        // Done with the mapping before -o possibly rewrites the same file
+        file.Close();
+
+        if (!WriteOutput(options, text)) return 1;
+        std::fprintf(stderr, "Removed %zu repeated texture hashes\n", removed);
+        return 0;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) return PrintUsage();
+
+    // filter is merge restricted to texture lines, which merge already is
+    if (options.command == "merge" || options.command == "filter") return RunMerge(options);
+    if (options.command == "diff") return RunDiff(options);
+    if (options.command == "dedupe") return RunDedupe(options);
+    return PrintUsage();
+}
@@ -0,0 +1,243 @@
+#include "bsp_file.h"
+
+#include <cstring>
+
+namespace WorldAPI {
+
+BSPFile::BSPFile()
+    : m_header(nullptr)
+    , m_staticPropVersion(0) {
+}
+
+BSPFile::~BSPFile() {
+    Close();
+}
+
+bool BSPFile::Open(const std::string& path) {
+    Close();
+    m_path = path;
+
+    if (!m_file.Open(path)) {
+        m_lastError = "could not map " + path;
+        return false;
+    }
+
+    return ParseHeader();
+}
+
+bool BSPFile::OpenFromBuffer(std::string&& data, const std::string& name) {
+    Close();
+    m_path = name;
+
+    m_file.AdoptBuffer(std::move(data));
+    if (!m_file.IsOpen()) {
+        m_lastError = "empty buffer for " + name;
+        return false;
+    }
+
+    return ParseHeader();
+}
+
+void BSPFile::Close() {
+    m_file.Close();
+    m_header = nullptr;
+    m_staticPropVersion = 0;
+    m_staticPropModels.clear();
+    m_staticPropLeaves = LumpView<uint16_t>();
+    m_staticProps = LumpView<BSPStaticProp>();
+}
+
+bool BSPFile::ParseHeader() {
+    if (m_file.Size() < sizeof(BSPHeader)) {
+        m_lastError = "file too small for a BSP header";
+        m_file.Close();
+        return false;
+    }
+
+    const BSPHeader* header = reinterpret_cast<const BSPHeader*>(m_file.Data());
+    if (header->ident != BSP_IDENT) {
+        m_lastError = "not a VBSP file";
+        m_file.Close();
+        return false;
+    }
+
+    if (header->version < 19 || header->version > 21) {
+        m_lastError = "unsupported BSP version " + std::to_string(header->version);
+        m_file.Close();
+        return false;
+    }
+
+    m_header = header;
+    m_lastError.clear();
+    ParseStaticProps();
+    return true;
+}
+
+std::string_view BSPFile::GetLumpData(int lump) const {
+    if (!m_header || lump < 0 || lump >= BSP_HEADER_LUMPS) return {};
+
+    const BSPLumpHeader& info = m_header->lumps[lump];
+    if (info.fileofs < 0 || info.filelen <= 0) return {};
+    if (static_cast<size_t>(info.fileofs) + static_cast<size_t>(info.filelen) > m_file.Size()) return {};
+
+    const char* data = reinterpret_cast<const char*>(m_file.Data()) + info.fileofs;
+
+    // LZMA lumps (Xbox/console ports, some recompiled maps) are not supported
+    if (info.fourCC != 0 && info.filelen >= 4) {
+        int32_t ident;
+        std::memcpy(&ident, data, sizeof(ident));
+        if (ident == BSP_LZMA_IDENT) return {};
+    }
+
+    return std::string_view(data, static_cast<size_t>(info.filelen));
+}
+
+int BSPFile::GetLumpVersion(int lump) const {
+    if (!m_header || lump < 0 || lump >= BSP_HEADER_LUMPS) return 0;
+    return m_header->lumps[lump].version;
+}
+
+LumpView<BSPLeaf> BSPFile::Leafs() const {
+    // Version 0 leafs carry a CompressedLightCube after the shared fields
+    const size_t stride = GetLumpVersion(LUMP_LEAFS) == 0 ? 56 : 32;
+    std::string_view data = GetLumpData(LUMP_LEAFS);
+    return LumpView<BSPLeaf>(reinterpret_cast<const uint8_t*>(data.data()), data.size() / stride, stride);
+}
+
+std::string_view BSPFile::Entities() const {
+    std::string_view data = GetLumpData(LUMP_ENTITIES);
+    while (!data.empty() && data.back() == '\0') data.remove_suffix(1);
+    return data;
+}
+
+std::string_view BSPFile::GetTexDataName(int texdata) const {
+    auto texData = TexData();
+    if (!texData.valid(texdata)) return {};
+
+    auto table = TexDataStringTable();
+    const int32_t tableIndex = texData[texdata].nameStringTableID;
+    if (!table.valid(tableIndex)) return {};
+
+    std::string_view strings = GetLumpData(LUMP_TEXDATA_STRING_DATA);
+    const int32_t offset = table[tableIndex];
+    if (offset < 0 || static_cast<size_t>(offset) >= strings.size()) return {};
+
+    std::string_view name = strings.substr(static_cast<size_t>(offset));
+    return name.substr(0, name.find('\0'));
+}
+
+std::string_view BSPFile::GetFaceMaterial(const BSPFace& face) const {
+    auto texInfo = TexInfo();
+    if (!texInfo.valid(face.texinfo)) return {};
+    return GetTexDataName(texInfo[face.texinfo].texdata);
+}
+
+bool BSPFile::GetFaceVertex(const BSPFace& face, int corner, BSPVector& out) const {
+    auto surfEdges = SurfEdges();
+    auto edges = Edges();
+    auto vertices = Vertices();
+
+    const int64_t surfIndex = static_cast<int64_t>(face.firstedge) + corner;
+    if (!surfEdges.valid(surfIndex)) return false;
+
+    const int32_t edge = surfEdges[static_cast<size_t>(surfIndex)];
+    const int64_t edgeIndex = edge >= 0 ? edge : -static_cast<int64_t>(edge);
+    if (!edges.valid(edgeIndex)) return false;
+
+    const uint16_t vertex = edges[static_cast<size_t>(edgeIndex)].v[edge >= 0 ? 0 : 1];
+    if (!vertices.valid(vertex)) return false;
+
+    out = vertices[vertex];
+    return true;
+}
+
+int BSPFile::FindLeaf(float x, float y, float z) const {
+    auto nodes = Nodes();
+    auto planes = Planes();
+    if (nodes.empty()) return Leafs().empty() ? -1 : 0;
+
+    int32_t node = Models().empty() ? 0 : Models()[0].headnode;
+    // Guard against malformed trees looping forever
+    for (size_t depth = 0; node >= 0 && depth < nodes.size(); ++depth) {
+        if (!nodes.valid(node)) return -1;
+        const BSPNode& current = nodes[node];
+        if (!planes.valid(current.planenum)) return -1;
+
+        const BSPPlane& plane = planes[current.planenum];
+        const float distance = x * plane.normal.x + y * plane.normal.y + z * plane.normal.z - plane.dist;
+        node = current.children[distance >= 0.0f ? 0 : 1];
+    }
+
+    if (node >= 0) return -1;
+    const int leaf = -1 - node;
+    return Leafs().valid(leaf) ? leaf : -1;
+}
+
+void BSPFile::ParseStaticProps() {
+    std::string_view gameLump = GetLumpData(LUMP_GAME_LUMP);
+    if (gameLump.size() < sizeof(int32_t)) return;
+
+    int32_t lumpCount;
+    std::memcpy(&lumpCount, gameLump.data(), sizeof(lumpCount));
+    if (lumpCount <= 0 || sizeof(int32_t) + static_cast<size_t>(lumpCount) * sizeof(BSPGameLump) > gameLump.size()) return;
+
+    const BSPGameLump* lumps = reinterpret_cast<const BSPGameLump*>(gameLump.data() + sizeof(int32_t));
+    const BSPGameLump* sprp = nullptr;
+    for (int32_t i = 0; i < lumpCount; ++i) {
+        if (lumps[i].id == GAMELUMP_STATIC_PROPS) {
+            sprp = &lumps[i];
+            break;
+        }
+    }
+
+    // Compressed game lumps (flag 1) are not supported
+    if (!sprp || (sprp->flags & 1) || sprp->fileofs < 0 || sprp->filelen <= 0) return;
+    if (static_cast<size_t>(sprp->fileofs) + static_cast<size_t>(sprp->filelen) > m_file.Size()) return;
+
+    const uint8_t* cursor = m_file.Data() + sprp->fileofs;
+    const uint8_t* end = cursor + sprp->filelen;
+
+    auto readCount = [&](int32_t& out) {
+        if (end - cursor < static_cast<ptrdiff_t>(sizeof(int32_t))) return false;
+        std::memcpy(&out, cursor, sizeof(int32_t));
+        cursor += sizeof(int32_t);
+        return out >= 0;
+    };
+
+    int32_t dictCount;
+    if (!readCount(dictCount)) return;
+    if (end - cursor < static_cast<ptrdiff_t>(dictCount) * BSP_STATIC_PROP_NAME_LENGTH) return;
+
+    std::vector<std::string_view> models;
+    models.reserve(dictCount);
+    for (int32_t i = 0; i < dictCount; ++i) {
+        const char* name = reinterpret_cast<const char*>(cursor);
+        models.emplace_back(name, strnlen(name, BSP_STATIC_PROP_NAME_LENGTH));
+        cursor += BSP_STATIC_PROP_NAME_LENGTH;
+    }
+
+    int32_t leafCount;
+    if (!readCount(leafCount)) return;
+    if (end - cursor < static_cast<ptrdiff_t>(leafCount) * static_cast<ptrdiff_t>(sizeof(uint16_t))) return;
+    LumpView<uint16_t> leaves(cursor, static_cast<size_t>(leafCount));
+    cursor += leafCount * sizeof(uint16_t);
+
+    int32_t propCount;
+    if (!readCount(propCount)) return;
+
+    LumpView<BSPStaticProp> props;
+    if (propCount > 0) {
+        // Record size varies between lump versions (and between branches sharing a
+        // version number), so derive it from the remaining bytes
+        const size_t stride = static_cast<size_t>(end - cursor) / static_cast<size_t>(propCount);
+        if (stride < sizeof(BSPStaticProp)) return;
+        props = LumpView<BSPStaticProp>(cursor, static_cast<size_t>(propCount), stride);
+    }
+
+    m_staticPropVersion = sprp->version;
+    m_staticPropModels = std::move(models);
+    m_staticPropLeaves = leaves;
+    m_staticProps = props;
+}
+
+} // namespace WorldAPI
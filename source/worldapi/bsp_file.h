@@ -0,0 +1,134 @@
+#pragma once
+
+#include "bsp_format.h"
+#include "mapped_file.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace WorldAPI {
+
+    // Zero-copy view over an array of records inside the mapped file. The stride can be
+    // larger than sizeof(T) for lumps whose record size depends on the lump version.
+    template <typename T>
+    class LumpView {
+    public:
+        class Iterator {
+        public:
+            Iterator(const uint8_t* ptr, size_t stride) : m_ptr(ptr), m_stride(stride) {}
+            const T& operator*() const { return *reinterpret_cast<const T*>(m_ptr); }
+            const T* operator->() const { return reinterpret_cast<const T*>(m_ptr); }
+            Iterator& operator++() { m_ptr += m_stride; return *this; }
+            bool operator!=(const Iterator& o) const { return m_ptr != o.m_ptr; }
+            bool operator==(const Iterator& o) const { return m_ptr == o.m_ptr; }
+
+        private:
+            const uint8_t* m_ptr;
+            size_t m_stride;
+        };
+
+        LumpView() : m_data(nullptr), m_count(0), m_stride(sizeof(T)) {}
+        LumpView(const uint8_t* data, size_t count, size_t stride = sizeof(T))
+            : m_data(data), m_count(count), m_stride(stride) {}
+
+        size_t size() const { return m_count; }
+        bool empty() const { return m_count == 0; }
+        size_t stride() const { return m_stride; }
+        bool valid(int64_t index) const { return index >= 0 && static_cast<size_t>(index) < m_count; }
+
+        const T& operator[](size_t index) const { return *reinterpret_cast<const T*>(m_data + index * m_stride); }
+
+        Iterator begin() const { return Iterator(m_data, m_stride); }
+        Iterator end() const { return Iterator(m_data + m_count * m_stride, m_stride); }
+
+    private:
+        const uint8_t* m_data;
+        size_t m_count;
+        size_t m_stride;
+    };
+
+    // Memory-mapped BSP. All accessors are read-only and safe to call from worker threads
+    // once Open() has returned; the views stay valid until Close() or destruction.
+    class BSPFile {
+    public:
+        BSPFile();
+        ~BSPFile();
+
+        BSPFile(const BSPFile&) = delete;
+        BSPFile& operator=(const BSPFile&) = delete;
+
+        bool Open(const std::string& path);
+        bool OpenFromBuffer(std::string&& data, const std::string& name);
+        void Close();
+
+        bool IsOpen() const { return m_file.IsOpen(); }
+        bool IsMapped() const { return m_file.IsMapped(); }
+        const std::string& GetPath() const { return m_path; }
+        const std::string& GetLastError() const { return m_lastError; }
+        size_t GetFileSize() const { return m_file.Size(); }
+        int GetVersion() const { return m_header ? m_header->version : 0; }
+        int GetMapRevision() const { return m_header ? m_header->mapRevision : 0; }
+
+        // Raw lump bytes; empty for missing, out of range or compressed lumps
+        std::string_view GetLumpData(int lump) const;
+        int GetLumpVersion(int lump) const;
+
+        LumpView<BSPPlane> Planes() const { return View<BSPPlane>(LUMP_PLANES); }
+        LumpView<BSPTexData> TexData() const { return View<BSPTexData>(LUMP_TEXDATA); }
+        LumpView<BSPVector> Vertices() const { return View<BSPVector>(LUMP_VERTEXES); }
+        LumpView<BSPNode> Nodes() const { return View<BSPNode>(LUMP_NODES); }
+        LumpView<BSPTexInfo> TexInfo() const { return View<BSPTexInfo>(LUMP_TEXINFO); }
+        LumpView<BSPFace> Faces() const { return View<BSPFace>(LUMP_FACES); }
+        LumpView<BSPLeaf> Leafs() const;
+        LumpView<BSPEdge> Edges() const { return View<BSPEdge>(LUMP_EDGES); }
+        LumpView<int32_t> SurfEdges() const { return View<int32_t>(LUMP_SURFEDGES); }
+        LumpView<BSPModel> Models() const { return View<BSPModel>(LUMP_MODELS); }
+        LumpView<uint16_t> LeafFaces() const { return View<uint16_t>(LUMP_LEAFFACES); }
+        LumpView<BSPDispInfo> DispInfo() const { return View<BSPDispInfo>(LUMP_DISPINFO); }
+        LumpView<BSPDispVert> DispVerts() const { return View<BSPDispVert>(LUMP_DISP_VERTS); }
+        LumpView<uint16_t> DispTris() const { return View<uint16_t>(LUMP_DISP_TRIS); }
+        LumpView<int32_t> TexDataStringTable() const { return View<int32_t>(LUMP_TEXDATA_STRING_TABLE); }
+
+        // Compressed PVS/PAS data: int numclusters, int bitofs[numclusters][2], RLE rows
+        std::string_view Visibility() const { return GetLumpData(LUMP_VISIBILITY); }
+        std::string_view Entities() const;
+
+        // Material name of a texdata entry ("" if out of range)
+        std::string_view GetTexDataName(int texdata) const;
+        // Material name used by a face, resolved through texinfo -> texdata
+        std::string_view GetFaceMaterial(const BSPFace& face) const;
+        // Position of a face's polygon corner, resolved through surfedges -> edges -> vertices
+        bool GetFaceVertex(const BSPFace& face, int corner, BSPVector& out) const;
+
+        // Walks the world node tree; returns the leaf index containing the point (-1 if none)
+        int FindLeaf(float x, float y, float z) const;
+
+        // Static prop game lump
+        int GetStaticPropVersion() const { return m_staticPropVersion; }
+        const std::vector<std::string_view>& StaticPropModels() const { return m_staticPropModels; }
+        LumpView<uint16_t> StaticPropLeaves() const { return m_staticPropLeaves; }
+        LumpView<BSPStaticProp> StaticProps() const { return m_staticProps; }
+
+    private:
+        template <typename T>
+        LumpView<T> View(int lump) const {
+            std::string_view data = GetLumpData(lump);
+            return LumpView<T>(reinterpret_cast<const uint8_t*>(data.data()), data.size() / sizeof(T));
+        }
+
+        bool ParseHeader();
+        void ParseStaticProps();
+
+        MappedFile m_file;
+        const BSPHeader* m_header;
+        std::string m_path;
+        std::string m_lastError;
+
+        int m_staticPropVersion;
+        std::vector<std::string_view> m_staticPropModels;
+        LumpView<uint16_t> m_staticPropLeaves;
+        LumpView<BSPStaticProp> m_staticProps;
+    };
+
+} // namespace WorldAPI
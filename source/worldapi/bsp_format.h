@@ -0,0 +1,234 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// On-disk structures of Source engine BSP files (versions 19-21, as shipped with GMod maps).
+// Kept self-contained instead of pulling in the SDK's bspfile.h so the reader has no
+// mathlib/tier dependencies; sizes are asserted against the engine layout.
+namespace WorldAPI {
+
+    constexpr int32_t BSP_IDENT = ('P' << 24) + ('S' << 16) + ('B' << 8) + 'V'; // "VBSP"
+    constexpr int32_t BSP_LZMA_IDENT = ('A' << 24) + ('M' << 16) + ('Z' << 8) + 'L'; // "LZMA"
+    constexpr int32_t GAMELUMP_STATIC_PROPS = ('s' << 24) + ('p' << 16) + ('r' << 8) + 'p'; // "sprp"
+    constexpr int BSP_HEADER_LUMPS = 64;
+    constexpr int BSP_STATIC_PROP_NAME_LENGTH = 128;
+    constexpr float BSP_MAX_COORD = 16384.0f; // MAX_COORD_INTEGER
+
+    enum BSPLump : int {
+        LUMP_ENTITIES = 0,
+        LUMP_PLANES = 1,
+        LUMP_TEXDATA = 2,
+        LUMP_VERTEXES = 3,
+        LUMP_VISIBILITY = 4,
+        LUMP_NODES = 5,
+        LUMP_TEXINFO = 6,
+        LUMP_FACES = 7,
+        LUMP_LEAFS = 10,
+        LUMP_EDGES = 12,
+        LUMP_SURFEDGES = 13,
+        LUMP_MODELS = 14,
+        LUMP_LEAFFACES = 16,
+        LUMP_DISPINFO = 26,
+        LUMP_DISP_VERTS = 33,
+        LUMP_GAME_LUMP = 35,
+        LUMP_TEXDATA_STRING_DATA = 43,
+        LUMP_TEXDATA_STRING_TABLE = 44,
+        LUMP_DISP_TRIS = 48
+    };
+
+    // Surface flags (texinfo_t::flags) used when filtering faces
+    enum BSPSurfaceFlags : int32_t {
+        SURF_LIGHT = 0x0001,
+        SURF_SKY2D = 0x0002,
+        SURF_SKY = 0x0004,
+        SURF_WARP = 0x0008,
+        SURF_TRANS = 0x0010,
+        SURF_NODRAW = 0x0080,
+        SURF_HINT = 0x0100,
+        SURF_SKIP = 0x0200
+    };
+
+#pragma pack(push, 1)
+
+    struct BSPVector {
+        float x, y, z;
+    };
+
+    struct BSPLumpHeader {
+        int32_t fileofs;
+        int32_t filelen;
+        int32_t version;
+        int32_t fourCC; // uncompressed size when the lump is LZMA compressed
+    };
+
+    struct BSPHeader {
+        int32_t ident;
+        int32_t version;
+        BSPLumpHeader lumps[BSP_HEADER_LUMPS];
+        int32_t mapRevision;
+    };
+
+    struct BSPPlane {
+        BSPVector normal;
+        float dist;
+        int32_t type;
+    };
+
+    struct BSPNode {
+        int32_t planenum;
+        int32_t children[2]; // negative numbers are -(leaf + 1)
+        int16_t mins[3];
+        int16_t maxs[3];
+        uint16_t firstface;
+        uint16_t numfaces;
+        int16_t area;
+        int16_t padding;
+    };
+
+    struct BSPEdge {
+        uint16_t v[2];
+    };
+
+    struct BSPFace {
+        uint16_t planenum;
+        uint8_t side;
+        uint8_t onNode;
+        int32_t firstedge;
+        int16_t numedges;
+        int16_t texinfo;
+        int16_t dispinfo;
+        int16_t surfaceFogVolumeID;
+        uint8_t styles[4];
+        int32_t lightofs;
+        float area;
+        int32_t lightmapTextureMinsInLuxels[2];
+        int32_t lightmapTextureSizeInLuxels[2];
+        int32_t origFace;
+        uint16_t numPrims;
+        uint16_t firstPrimID;
+        uint32_t smoothingGroups;
+    };
+
+    struct BSPTexInfo {
+        float textureVecs[2][4];
+        float lightmapVecs[2][4];
+        int32_t flags;
+        int32_t texdata;
+    };
+
+    struct BSPTexData {
+        BSPVector reflectivity;
+        int32_t nameStringTableID;
+        int32_t width;
+        int32_t height;
+        int32_t viewWidth;
+        int32_t viewHeight;
+    };
+
+    // Common prefix of dleaf_t; lump version 0 appends 24 bytes of ambient lighting,
+    // so leafs are always read through a strided view.
+    struct BSPLeaf {
+        int32_t contents;
+        int16_t cluster;
+        int16_t areaFlags; // area:9, flags:7
+        int16_t mins[3];
+        int16_t maxs[3];
+        uint16_t firstleafface;
+        uint16_t numleaffaces;
+        uint16_t firstleafbrush;
+        uint16_t numleafbrushes;
+        int16_t leafWaterDataID;
+    };
+
+    struct BSPModel {
+        BSPVector mins;
+        BSPVector maxs;
+        BSPVector origin;
+        int32_t headnode;
+        int32_t firstface;
+        int32_t numfaces;
+    };
+
+    struct BSPDispSubNeighbor {
+        uint16_t neighbor;
+        uint8_t neighborOrientation;
+        uint8_t span;
+        uint8_t neighborSpan;
+        uint8_t padding;
+    };
+
+    struct BSPDispNeighbor {
+        BSPDispSubNeighbor subNeighbors[2];
+    };
+
+    struct BSPDispCornerNeighbors {
+        uint16_t neighbors[4];
+        uint8_t numNeighbors;
+        uint8_t padding;
+    };
+
+    struct BSPDispInfo {
+        BSPVector startPosition;
+        int32_t dispVertStart;
+        int32_t dispTriStart;
+        int32_t power;
+        int32_t minTess;
+        float smoothingAngle;
+        int32_t contents;
+        uint16_t mapFace;
+        uint16_t padding;
+        int32_t lightmapAlphaStart;
+        int32_t lightmapSamplePositionStart;
+        BSPDispNeighbor edgeNeighbors[4];
+        BSPDispCornerNeighbors cornerNeighbors[4];
+        uint32_t allowedVerts[10];
+    };
+
+    struct BSPDispVert {
+        BSPVector vec;
+        float dist;
+        float alpha;
+    };
+
+    struct BSPGameLump {
+        int32_t id;
+        uint16_t flags;
+        uint16_t version;
+        int32_t fileofs;
+        int32_t filelen;
+    };
+
+    // Fields shared by every static prop lump version (v4 and later). Newer versions
+    // append data, so props are read with the stride derived from the lump size.
+    struct BSPStaticProp {
+        BSPVector origin;
+        BSPVector angles;
+        uint16_t propType;
+        uint16_t firstLeaf;
+        uint16_t leafCount;
+        uint8_t solid;
+        uint8_t flags;
+        int32_t skin;
+        float fadeMinDist;
+        float fadeMaxDist;
+        BSPVector lightingOrigin;
+    };
+
+#pragma pack(pop)
+
+    static_assert(sizeof(BSPHeader) == 1036, "BSPHeader layout mismatch");
+    static_assert(sizeof(BSPPlane) == 20, "BSPPlane layout mismatch");
+    static_assert(sizeof(BSPNode) == 32, "BSPNode layout mismatch");
+    static_assert(sizeof(BSPEdge) == 4, "BSPEdge layout mismatch");
+    static_assert(sizeof(BSPFace) == 56, "BSPFace layout mismatch");
+    static_assert(sizeof(BSPTexInfo) == 72, "BSPTexInfo layout mismatch");
+    static_assert(sizeof(BSPTexData) == 32, "BSPTexData layout mismatch");
+    static_assert(sizeof(BSPLeaf) == 30, "BSPLeaf layout mismatch");
+    static_assert(sizeof(BSPModel) == 48, "BSPModel layout mismatch");
+    static_assert(sizeof(BSPDispInfo) == 176, "BSPDispInfo layout mismatch");
+    static_assert(sizeof(BSPDispVert) == 20, "BSPDispVert layout mismatch");
+    static_assert(sizeof(BSPGameLump) == 16, "BSPGameLump layout mismatch");
+    static_assert(sizeof(BSPStaticProp) == 56, "BSPStaticProp layout mismatch");
+
+} // namespace WorldAPI
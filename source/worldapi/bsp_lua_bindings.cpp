@@ -0,0 +1,613 @@
+#include "worldapi.h"
+#include "map_lights.h"
+#include "static_props.h"
+#ifdef _WIN64
+#include "../remixapi/remixapi.h"
+#endif
+#include <tier0/dbg.h>
+#include <mathlib/vector.h>
+
+using namespace GarrysMod::Lua;
+
+namespace WorldAPI {
+
+static std::shared_ptr<const BSPFile> CurrentMap() {
+    return WorldAPI::Instance().GetBSPManager().GetMap();
+}
+
+static void PushStringView(ILuaBase* LUA, std::string_view value) {
+    LUA->PushString(value.data(), static_cast<unsigned int>(value.size()));
+}
+
+// Lua function: RemixBSP.Open(path) -> bool, error
+LUA_FUNCTION(RemixBSP_Open) {
+    if (!LUA->IsType(1, Type::String)) {
+        LUA->ThrowError("Expected string for map path");
+        return 0;
+    }
+
+    std::string error;
+    if (!WorldAPI::Instance().GetBSPManager().OpenMap(LUA->GetString(1), error)) {
+        LUA->PushBool(false);
+        LUA->PushString(error.c_str());
+        return 2;
+    }
+
+    LUA->PushBool(true);
+    return 1;
+}
+
+// Lua function: RemixBSP.OpenFromString(data, name) -> bool, error
+LUA_FUNCTION(RemixBSP_OpenFromString) {
+    if (!LUA->IsType(1, Type::String)) {
+        LUA->ThrowError("Expected string for map data");
+        return 0;
+    }
+
+    unsigned int length = 0;
+    const char* data = LUA->GetString(1, &length);
+    std::string name = LUA->IsType(2, Type::String) ? LUA->GetString(2) : "<buffer>";
+
+    std::string error;
+    if (!WorldAPI::Instance().GetBSPManager().OpenMapFromBuffer(std::string(data, length), name, error)) {
+        LUA->PushBool(false);
+        LUA->PushString(error.c_str());
+        return 2;
+    }
+
+    LUA->PushBool(true);
+    return 1;
+}
+
+// Lua function: RemixBSP.Close()
+LUA_FUNCTION(RemixBSP_Close) {
+    WorldAPI::Instance().GetBSPManager().CloseMap();
+    return 0;
+}
+
+// Lua function: RemixBSP.IsOpen() -> bool
+LUA_FUNCTION(RemixBSP_IsOpen) {
+    auto map = CurrentMap();
+    LUA->PushBool(map && map->IsOpen());
+    return 1;
+}
+
+// Lua function: RemixBSP.GetInfo() -> { path, version, revision, size, mapped, lumps = { name = count } }
+LUA_FUNCTION(RemixBSP_GetInfo) {
+    auto map = CurrentMap();
+    if (!map) {
+        LUA->PushNil();
+        return 1;
+    }
+
+    LUA->CreateTable();
+    LUA->PushString(map->GetPath().c_str()); LUA->SetField(-2, "path");
+    LUA->PushNumber(map->GetVersion()); LUA->SetField(-2, "version");
+    LUA->PushNumber(map->GetMapRevision()); LUA->SetField(-2, "revision");
+    LUA->PushNumber(static_cast<double>(map->GetFileSize())); LUA->SetField(-2, "size");
+    LUA->PushBool(map->IsMapped()); LUA->SetField(-2, "mapped");
+
+    LUA->CreateTable();
+    LUA->PushNumber(static_cast<double>(map->Planes().size())); LUA->SetField(-2, "planes");
+    LUA->PushNumber(static_cast<double>(map->Vertices().size())); LUA->SetField(-2, "vertices");
+    LUA->PushNumber(static_cast<double>(map->Edges().size())); LUA->SetField(-2, "edges");
+    LUA->PushNumber(static_cast<double>(map->SurfEdges().size())); LUA->SetField(-2, "surfedges");
+    LUA->PushNumber(static_cast<double>(map->Faces().size())); LUA->SetField(-2, "faces");
+    LUA->PushNumber(static_cast<double>(map->TexInfo().size())); LUA->SetField(-2, "texinfo");
+    LUA->PushNumber(static_cast<double>(map->TexData().size())); LUA->SetField(-2, "texdata");
+    LUA->PushNumber(static_cast<double>(map->Leafs().size())); LUA->SetField(-2, "leafs");
+    LUA->PushNumber(static_cast<double>(map->Models().size())); LUA->SetField(-2, "models");
+    LUA->PushNumber(static_cast<double>(map->DispInfo().size())); LUA->SetField(-2, "dispinfo");
+    LUA->PushNumber(static_cast<double>(map->DispVerts().size())); LUA->SetField(-2, "dispverts");
+    LUA->PushNumber(static_cast<double>(map->Visibility().size())); LUA->SetField(-2, "visibility");
+    LUA->PushNumber(static_cast<double>(map->Entities().size())); LUA->SetField(-2, "entities");
+    LUA->PushNumber(static_cast<double>(map->StaticProps().size())); LUA->SetField(-2, "staticprops");
+    LUA->SetField(-2, "lumps");
+
+    return 1;
+}
+
+// Lua function: RemixBSP.GetEntities() -> string (raw entity lump)
+LUA_FUNCTION(RemixBSP_GetEntities) {
+    auto map = CurrentMap();
+    if (!map) {
+        LUA->PushNil();
+        return 1;
+    }
+
+    PushStringView(LUA, map->Entities());
+    return 1;
+}
+
+// Lua function: RemixBSP.GetTexDataName(texdataIndex) -> string (0-based, as stored in the BSP)
+LUA_FUNCTION(RemixBSP_GetTexDataName) {
+    if (!LUA->IsType(1, Type::Number)) {
+        LUA->ThrowError("Expected number for texdata index");
+        return 0;
+    }
+
+    auto map = CurrentMap();
+    if (!map) {
+        LUA->PushNil();
+        return 1;
+    }
+
+    PushStringView(LUA, map->GetTexDataName(static_cast<int>(LUA->GetNumber(1))));
+    return 1;
+}
+
+// Lua function: RemixBSP.GetFace(faceIndex) -> table (0-based, as stored in the BSP)
+LUA_FUNCTION(RemixBSP_GetFace) {
+    if (!LUA->IsType(1, Type::Number)) {
+        LUA->ThrowError("Expected number for face index");
+        return 0;
+    }
+
+    auto map = CurrentMap();
+    const int index = static_cast<int>(LUA->GetNumber(1));
+    if (!map || !map->Faces().valid(index)) {
+        LUA->PushNil();
+        return 1;
+    }
+
+    const BSPFace& face = map->Faces()[index];
+    LUA->CreateTable();
+    LUA->PushNumber(face.planenum); LUA->SetField(-2, "planenum");
+    LUA->PushNumber(face.firstedge); LUA->SetField(-2, "firstedge");
+    LUA->PushNumber(face.numedges); LUA->SetField(-2, "numedges");
+    LUA->PushNumber(face.texinfo); LUA->SetField(-2, "texinfo");
+    LUA->PushNumber(face.dispinfo); LUA->SetField(-2, "dispinfo");
+    LUA->PushNumber(face.area); LUA->SetField(-2, "area");
+    PushStringView(LUA, map->GetFaceMaterial(face)); LUA->SetField(-2, "material");
+    return 1;
+}
+
+// Lua function: RemixBSP.GetStaticProps() -> array of { model, skin, origin, angles, solid, flags, fademin, fademax }
+LUA_FUNCTION(RemixBSP_GetStaticProps) {
+    auto map = CurrentMap();
+    if (!map) {
+        LUA->PushNil();
+        return 1;
+    }
+
+    const auto& models = map->StaticPropModels();
+    const auto props = map->StaticProps();
+
+    LUA->CreateTable();
+    for (size_t i = 0; i < props.size(); ++i) {
+        const BSPStaticProp& prop = props[i];
+
+        LUA->PushNumber(static_cast<double>(i + 1));
+        LUA->CreateTable();
+        if (prop.propType < models.size()) {
+            PushStringView(LUA, models[prop.propType]);
+            LUA->SetField(-2, "model");
+        }
+        LUA->PushNumber(prop.skin); LUA->SetField(-2, "skin");
+        LUA->PushVector(Vector(prop.origin.x, prop.origin.y, prop.origin.z)); LUA->SetField(-2, "origin");
+        LUA->PushAngle(QAngle(prop.angles.x, prop.angles.y, prop.angles.z)); LUA->SetField(-2, "angles");
+        LUA->PushNumber(prop.solid); LUA->SetField(-2, "solid");
+        LUA->PushNumber(prop.flags); LUA->SetField(-2, "flags");
+        LUA->PushNumber(prop.fadeMinDist); LUA->SetField(-2, "fademin");
+        LUA->PushNumber(prop.fadeMaxDist); LUA->SetField(-2, "fademax");
+        LUA->SetTable(-3);
+    }
+    return 1;
+}
+
+// Lua function: RemixBSP.GetStaticPropBatches(binSize?)
+// Returns { { model, skin, skybox, bin = "x,y,z", mins, maxs, transforms = { { row1, row2, row3, row4 }, ... },
+// colors = { [instance] = { r, g, b, a } } }, ... }. Transforms are ready for Matrix(); colors only
+// lists instances whose diffuse modulation is not white.
+LUA_FUNCTION(RemixBSP_GetStaticPropBatches) {
+    auto map = CurrentMap();
+    if (!map) {
+        LUA->PushNil();
+        return 1;
+    }
+
+    const int binSize = LUA->IsType(1, Type::Number) ? static_cast<int>(LUA->GetNumber(1)) : 0;
+    const auto batches = BuildStaticPropBatches(*map, binSize);
+
+    LUA->CreateTable();
+    for (size_t b = 0; b < batches.size(); ++b) {
+        const StaticPropBatch& batch = batches[b];
+        const std::string binKey = std::to_string(batch.bin[0]) + "," + std::to_string(batch.bin[1]) + "," + std::to_string(batch.bin[2]);
+
+        LUA->PushNumber(static_cast<double>(b + 1));
+        LUA->CreateTable();
+        LUA->PushString(batch.model.c_str()); LUA->SetField(-2, "model");
+        LUA->PushNumber(batch.skin); LUA->SetField(-2, "skin");
+        LUA->PushBool(batch.skybox); LUA->SetField(-2, "skybox");
+        LUA->PushString(binKey.c_str()); LUA->SetField(-2, "bin");
+        LUA->PushVector(Vector(batch.mins[0], batch.mins[1], batch.mins[2])); LUA->SetField(-2, "mins");
+        LUA->PushVector(Vector(batch.maxs[0], batch.maxs[1], batch.maxs[2])); LUA->SetField(-2, "maxs");
+
+        LUA->CreateTable();
+        for (size_t i = 0; i < batch.instances.size(); ++i) {
+            const float* m = batch.instances[i].transform;
+            LUA->PushNumber(static_cast<double>(i + 1));
+            LUA->CreateTable();
+            for (int row = 0; row < 4; ++row) {
+                LUA->PushNumber(row + 1);
+                LUA->CreateTable();
+                for (int col = 0; col < 4; ++col) {
+                    LUA->PushNumber(col + 1);
+                    LUA->PushNumber(row < 3 ? m[row * 4 + col] : (col == 3 ? 1.0 : 0.0));
+                    LUA->SetTable(-3);
+                }
+                LUA->SetTable(-3);
+            }
+            LUA->SetTable(-3);
+        }
+        LUA->SetField(-2, "transforms");
+
+        LUA->CreateTable();
+        for (size_t i = 0; i < batch.instances.size(); ++i) {
+            const uint8_t* color = batch.instances[i].color;
+            if (color[0] == 255 && color[1] == 255 && color[2] == 255) continue;
+
+            LUA->PushNumber(static_cast<double>(i + 1));
+            LUA->CreateTable();
+            LUA->PushNumber(color[0]); LUA->SetField(-2, "r");
+            LUA->PushNumber(color[1]); LUA->SetField(-2, "g");
+            LUA->PushNumber(color[2]); LUA->SetField(-2, "b");
+            LUA->PushNumber(color[3]); LUA->SetField(-2, "a");
+            LUA->SetTable(-3);
+        }
+        LUA->SetField(-2, "colors");
+
+        LUA->SetTable(-3);
+    }
+    return 1;
+}
+
+// Reads { brightness?, size?, minSize?, maxSize?, jitter?, environment? } at stack index 1
+static MapLightSettings ReadMapLightSettings(ILuaBase* LUA) {
+    MapLightSettings settings;
+    if (!LUA->IsType(1, Type::Table)) return settings;
+
+    auto readNumber = [LUA](const char* field, float& out) {
+        LUA->GetField(1, field);
+        if (LUA->IsType(-1, Type::Number)) out = static_cast<float>(LUA->GetNumber(-1));
+        LUA->Pop();
+    };
+    readNumber("brightness", settings.brightness);
+    readNumber("size", settings.sizeMultiplier);
+    readNumber("minSize", settings.minSize);
+    readNumber("maxSize", settings.maxSize);
+    readNumber("jitter", settings.jitter);
+    readNumber("rotationX", settings.rotation[0]);
+    readNumber("rotationY", settings.rotation[1]);
+    readNumber("rotationZ", settings.rotation[2]);
+
+    float basis = static_cast<float>(settings.directionBasis);
+    readNumber("basis", basis);
+    settings.directionBasis = static_cast<int>(basis);
+
+    LUA->GetField(1, "environment");
+    if (LUA->IsType(-1, Type::Bool)) settings.environment = LUA->GetBool(-1);
+    LUA->Pop();
+    return settings;
+}
+
+// Pushes one converted light as { classname, pos, color = { r, g, b }, brightness, size, hash,
+// shaped, direction, cone, softness, angles? }
+static void PushMapLight(ILuaBase* LUA, const MapLight& light) {
+    LUA->CreateTable();
+    LUA->PushString(light.classname.c_str()); LUA->SetField(-2, "classname");
+    LUA->PushVector(Vector(light.position[0], light.position[1], light.position[2])); LUA->SetField(-2, "pos");
+
+    LUA->CreateTable();
+    LUA->PushNumber(light.color[0]); LUA->SetField(-2, "r");
+    LUA->PushNumber(light.color[1]); LUA->SetField(-2, "g");
+    LUA->PushNumber(light.color[2]); LUA->SetField(-2, "b");
+    LUA->SetField(-2, "color");
+
+    LUA->PushNumber(light.brightness); LUA->SetField(-2, "brightness");
+    LUA->PushNumber(light.size); LUA->SetField(-2, "size");
+    LUA->PushNumber(light.hash); LUA->SetField(-2, "hash");
+    LUA->PushBool(light.shaped); LUA->SetField(-2, "shaped");
+    LUA->PushVector(Vector(light.direction[0], light.direction[1], light.direction[2])); LUA->SetField(-2, "direction");
+    LUA->PushNumber(light.coneAngle); LUA->SetField(-2, "cone");
+    LUA->PushNumber(light.coneSoftness); LUA->SetField(-2, "softness");
+    if (light.hasAngles) {
+        LUA->PushAngle(QAngle(light.angles[0], light.angles[1], light.angles[2])); LUA->SetField(-2, "angles");
+    }
+}
+
+// Lua function: RemixBSP.GetMapLights(settings?) -> array of lights (see PushMapLight), nil without a map
+LUA_FUNCTION(RemixBSP_GetMapLights) {
+    auto map = CurrentMap();
+    if (!map) {
+        LUA->PushNil();
+        return 1;
+    }
+
+    const auto lights = ExtractMapLights(ParseEntities(map->Entities()), ReadMapLightSettings(LUA));
+
+    LUA->CreateTable();
+    for (size_t i = 0; i < lights.size(); ++i) {
+        LUA->PushNumber(static_cast<double>(i + 1));
+        PushMapLight(LUA, lights[i]);
+        LUA->SetTable(-3);
+    }
+    return 1;
+}
+
+#ifdef _WIN64
+// Lua function: RemixBSP.CreateMapLights(settings?, firstEntityId?) -> array of lights, each with id and entityId
+// Converts the map's lights and creates them as Remix sphere lights in a single LightManager call.
+// Lights that failed to create are left out; entity ids count up from firstEntityId.
+LUA_FUNCTION(RemixBSP_CreateMapLights) {
+    auto map = CurrentMap();
+    if (!map) {
+        LUA->PushNil();
+        return 1;
+    }
+
+    const auto lights = ExtractMapLights(ParseEntities(map->Entities()), ReadMapLightSettings(LUA));
+    const uint64_t firstEntityId = LUA->IsType(2, Type::Number) ? static_cast<uint64_t>(LUA->GetNumber(2)) : 1;
+
+    std::vector<RemixAPI::LightManager::SphereLightRequest> requests(lights.size());
+    for (size_t i = 0; i < lights.size(); ++i) {
+        const MapLight& light = lights[i];
+        auto& request = requests[i];
+
+        const float scale = light.brightness / 100.0f;
+        request.base.hash = light.hash;
+        request.base.radiance = { light.color[0] * scale, light.color[1] * scale, light.color[2] * scale };
+
+        request.sphere.position = { light.position[0], light.position[1], light.position[2] };
+        request.sphere.radius = light.size;
+        request.sphere.volumetricRadianceScale = 1.0f;
+        if (light.shaped) {
+            remix::LightInfoLightShaping shaping;
+            shaping.direction = { light.direction[0], light.direction[1], light.direction[2] };
+            shaping.coneAngleDegrees = light.coneAngle;
+            shaping.coneSoftness = light.coneSoftness;
+            shaping.focusExponent = 1.0f;
+            request.sphere.set_shaping(shaping);
+        }
+        request.entityId = firstEntityId + i;
+    }
+
+    const auto ids = RemixAPI::RemixAPI::Instance().GetLightManager().CreateSphereLights(requests);
+
+    LUA->CreateTable();
+    size_t created = 0;
+    for (size_t i = 0; i < lights.size(); ++i) {
+        if (!ids[i]) continue;
+
+        LUA->PushNumber(static_cast<double>(++created));
+        PushMapLight(LUA, lights[i]);
+        LUA->PushNumber(static_cast<double>(ids[i])); LUA->SetField(-2, "id");
+        LUA->PushNumber(static_cast<double>(requests[i].entityId)); LUA->SetField(-2, "entityId");
+        LUA->SetTable(-3);
+    }
+
+    Msg("[BSPManager] Created %zu of %zu map lights\n", created, lights.size());
+    return 1;
+}
+#endif
+
+// Lua function: RemixBSP.GetClusterForPoint(pos) -> cluster (-1 outside the map)
+LUA_FUNCTION(RemixBSP_GetClusterForPoint) {
+    if (!LUA->IsType(1, Type::Vector)) {
+        LUA->ThrowError("Expected Vector for position");
+        return 0;
+    }
+
+    const Vector& pos = LUA->GetVector(1);
+    LUA->PushNumber(WorldAPI::Instance().GetBSPManager().FindCluster(pos.x, pos.y, pos.z));
+    return 1;
+}
+
+// Lua function: RemixBSP.IsClusterVisible(fromCluster, toCluster) -> bool
+LUA_FUNCTION(RemixBSP_IsClusterVisible) {
+    if (!LUA->IsType(1, Type::Number) || !LUA->IsType(2, Type::Number)) {
+        LUA->ThrowError("Expected two cluster numbers");
+        return 0;
+    }
+
+    const auto& visibility = WorldAPI::Instance().GetBSPManager().GetVisibility();
+    LUA->PushBool(visibility.IsVisible(static_cast<int>(LUA->GetNumber(1)), static_cast<int>(LUA->GetNumber(2))));
+    return 1;
+}
+
+// Lua function: RemixBSP.RegisterChunkClusters(setName, clusters) -> chunkIndex
+// clusters may be a set ({ [cluster] = true }) or an array of cluster numbers.
+LUA_FUNCTION(RemixBSP_RegisterChunkClusters) {
+    if (!LUA->IsType(1, Type::String) || !LUA->IsType(2, Type::Table)) {
+        LUA->ThrowError("Expected set name and cluster table");
+        return 0;
+    }
+
+    std::vector<int32_t> clusters;
+    LUA->PushNil();
+    while (LUA->Next(2) != 0) {
+        if (LUA->IsType(-1, Type::Number)) {
+            clusters.push_back(static_cast<int32_t>(LUA->GetNumber(-1)));
+        } else if (LUA->IsType(-2, Type::Number)) {
+            clusters.push_back(static_cast<int32_t>(LUA->GetNumber(-2)));
+        }
+        LUA->Pop();
+    }
+
+    const size_t index = WorldAPI::Instance().GetBSPManager().RegisterChunk(LUA->GetString(1), clusters);
+    LUA->PushNumber(static_cast<double>(index + 1));
+    return 1;
+}
+
+// Lua function: RemixBSP.ClearChunkClusters(setName)
+LUA_FUNCTION(RemixBSP_ClearChunkClusters) {
+    if (!LUA->IsType(1, Type::String)) {
+        LUA->ThrowError("Expected set name");
+        return 0;
+    }
+
+    WorldAPI::Instance().GetBSPManager().ClearChunks(LUA->GetString(1));
+    return 0;
+}
+
+// Lua function: RemixBSP.GetVisibleChunks(setName, viewCluster) -> { [chunkIndex] = true }
+// Returns nil when the map has no vis data so callers can skip PVS culling entirely.
+LUA_FUNCTION(RemixBSP_GetVisibleChunks) {
+    if (!LUA->IsType(1, Type::String) || !LUA->IsType(2, Type::Number)) {
+        LUA->ThrowError("Expected set name and view cluster");
+        return 0;
+    }
+
+    auto& bspManager = WorldAPI::Instance().GetBSPManager();
+    if (!bspManager.GetVisibility().IsLoaded()) {
+        LUA->PushNil();
+        return 1;
+    }
+
+    static std::vector<uint32_t> visible;
+    bspManager.QueryVisibleChunks(LUA->GetString(1), static_cast<int>(LUA->GetNumber(2)), visible);
+
+    LUA->CreateTable();
+    for (uint32_t index : visible) {
+        LUA->PushNumber(static_cast<double>(index + 1));
+        LUA->PushBool(true);
+        LUA->SetTable(-3);
+    }
+    return 1;
+}
+
+// Lua function: RemixBSP.LoadPortals(data) -> bool, error
+// data is the map's .prt file, read through Lua so portal files shipped in addons work too
+LUA_FUNCTION(RemixBSP_LoadPortals) {
+    if (!LUA->IsType(1, Type::String)) {
+        LUA->ThrowError("Expected string for portal file data");
+        return 0;
+    }
+
+    unsigned int length = 0;
+    const char* data = LUA->GetString(1, &length);
+
+    std::string error;
+    if (!WorldAPI::Instance().GetBSPManager().LoadPortals(std::string_view(data, length), error)) {
+        LUA->PushBool(false);
+        LUA->PushString(error.c_str());
+        return 2;
+    }
+
+    LUA->PushBool(true);
+    return 1;
+}
+
+// Lua function: RemixBSP.HasPortals() -> bool
+LUA_FUNCTION(RemixBSP_HasPortals) {
+    LUA->PushBool(WorldAPI::Instance().GetBSPManager().HasPortals());
+    return 1;
+}
+
+// Lua function: RemixBSP.GetPortalVisibleChunks(setName) -> { [chunkIndex] = true }
+// Portal flow from the view last passed to RemixCull.SetView. Returns nil when there is no
+// flow for this view, in which case callers use GetVisibleChunks (the PVS) instead.
+LUA_FUNCTION(RemixBSP_GetPortalVisibleChunks) {
+    if (!LUA->IsType(1, Type::String)) {
+        LUA->ThrowError("Expected set name");
+        return 0;
+    }
+
+    const Frustum* view = WorldAPI::Instance().GetCullManager().GetView();
+    static std::vector<uint32_t> visible;
+    if (!view || !WorldAPI::Instance().GetBSPManager().QueryPortalVisibleChunks(LUA->GetString(1), *view, visible)) {
+        LUA->PushNil();
+        return 1;
+    }
+
+    LUA->CreateTable();
+    for (uint32_t index : visible) {
+        LUA->PushNumber(static_cast<double>(index + 1));
+        LUA->PushBool(true);
+        LUA->SetTable(-3);
+    }
+    return 1;
+}
+
+// Initialize BSP Manager Lua bindings
+void BSPManager::InitializeLuaBindings() {
+    if (!m_lua) return;
+
+    // Get the global table
+    m_lua->PushSpecial(GarrysMod::Lua::SPECIAL_GLOB);
+
+    // Create RemixBSP table
+    m_lua->CreateTable();
+
+    m_lua->PushCFunction(RemixBSP_Open);
+    m_lua->SetField(-2, "Open");
+
+    m_lua->PushCFunction(RemixBSP_OpenFromString);
+    m_lua->SetField(-2, "OpenFromString");
+
+    m_lua->PushCFunction(RemixBSP_Close);
+    m_lua->SetField(-2, "Close");
+
+    m_lua->PushCFunction(RemixBSP_IsOpen);
+    m_lua->SetField(-2, "IsOpen");
+
+    m_lua->PushCFunction(RemixBSP_GetInfo);
+    m_lua->SetField(-2, "GetInfo");
+
+    m_lua->PushCFunction(RemixBSP_GetEntities);
+    m_lua->SetField(-2, "GetEntities");
+
+    m_lua->PushCFunction(RemixBSP_GetTexDataName);
+    m_lua->SetField(-2, "GetTexDataName");
+
+    m_lua->PushCFunction(RemixBSP_GetFace);
+    m_lua->SetField(-2, "GetFace");
+
+    m_lua->PushCFunction(RemixBSP_GetStaticProps);
+    m_lua->SetField(-2, "GetStaticProps");
+
+    m_lua->PushCFunction(RemixBSP_GetStaticPropBatches);
+    m_lua->SetField(-2, "GetStaticPropBatches");
+
+    m_lua->PushCFunction(RemixBSP_GetMapLights);
+    m_lua->SetField(-2, "GetMapLights");
+
+#ifdef _WIN64
+    m_lua->PushCFunction(RemixBSP_CreateMapLights);
+    m_lua->SetField(-2, "CreateMapLights");
+#endif
+
+    m_lua->PushCFunction(RemixBSP_GetClusterForPoint);
+    m_lua->SetField(-2, "GetClusterForPoint");
+
+    m_lua->PushCFunction(RemixBSP_IsClusterVisible);
+    m_lua->SetField(-2, "IsClusterVisible");
+
+    m_lua->PushCFunction(RemixBSP_RegisterChunkClusters);
+    m_lua->SetField(-2, "RegisterChunkClusters");
+
+    m_lua->PushCFunction(RemixBSP_ClearChunkClusters);
+    m_lua->SetField(-2, "ClearChunkClusters");
+
+    m_lua->PushCFunction(RemixBSP_GetVisibleChunks);
+    m_lua->SetField(-2, "GetVisibleChunks");
+
+    m_lua->PushCFunction(RemixBSP_LoadPortals);
+    m_lua->SetField(-2, "LoadPortals");
+
+    m_lua->PushCFunction(RemixBSP_HasPortals);
+    m_lua->SetField(-2, "HasPortals");
+
+    m_lua->PushCFunction(RemixBSP_GetPortalVisibleChunks);
+    m_lua->SetField(-2, "GetPortalVisibleChunks");
+
+    // Set the table as a global field
+    m_lua->SetField(-2, "RemixBSP");
+
+    // Pop the global table
+    m_lua->Pop();
+
+    Msg("[BSPManager] Lua bindings initialized\n");
+}
+
+} // namespace WorldAPI
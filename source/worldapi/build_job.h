@@ -0,0 +1,52 @@
+#pragma once
+
+#include "build_progress.h"
+#include "displacement_builder.h"
+#include "world_builder.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace WorldAPI {
+
+    enum class BuildKind {
+        World,
+        Displacements
+    };
+
+    enum class BuildState {
+        Running,
+        Done,
+        Failed,
+        Cancelled
+    };
+
+    // One background build. The worker fills the result for its kind and publishes the state
+    // last; the game thread only reads the result after observing Done.
+    struct BuildJob {
+        uint32_t id = 0;
+        BuildKind kind = BuildKind::World;
+        BuildProgress progress;
+        std::atomic<BuildState> state { BuildState::Running };
+        std::string error;
+
+        WorldBuildSettings worldSettings;
+        DisplacementBuildSettings displacementSettings;
+        WorldBuildResult world;
+        std::vector<std::vector<std::vector<MeshVertex>>> worldLods; // group -> level - 1 -> triangles
+        DisplacementBuildResult displacements;
+    };
+
+    inline const char* GetBuildStateName(BuildState state) {
+        switch (state) {
+            case BuildState::Running: return "running";
+            case BuildState::Done: return "done";
+            case BuildState::Failed: return "failed";
+            case BuildState::Cancelled: return "cancelled";
+        }
+        return "unknown";
+    }
+
+} // namespace WorldAPI
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace WorldAPI {
+
+    // Progress and cancellation shared between a build running on the worker threads and the
+    // game thread polling it. Builders check IsCancelled() between work items and stop early;
+    // a cancelled build's partial result is discarded by the owner.
+    class BuildProgress {
+    public:
+        void Cancel() { m_cancelled.store(true, std::memory_order_relaxed); }
+        bool IsCancelled() const { return m_cancelled.load(std::memory_order_relaxed); }
+
+        // Work units of the current stage; the fraction is done / total
+        void SetTotal(size_t total) {
+            m_done.store(0, std::memory_order_relaxed);
+            m_total.store(total, std::memory_order_relaxed);
+        }
+        void Advance(size_t units = 1) { m_done.fetch_add(units, std::memory_order_relaxed); }
+
+        float GetFraction() const {
+            const size_t total = m_total.load(std::memory_order_relaxed);
+            return total ? static_cast<float>(m_done.load(std::memory_order_relaxed)) / static_cast<float>(total) : 0.0f;
+        }
+
+    private:
+        std::atomic<bool> m_cancelled { false };
+        std::atomic<size_t> m_total { 0 };
+        std::atomic<size_t> m_done { 0 };
+    };
+
+} // namespace WorldAPI
@@ -0,0 +1,127 @@
+#include "cull_kernel.h"
+#include "spatial_index.h"
+
+#ifdef WORLDAPI_CULL_SSE
+#include <emmintrin.h>
+#endif
+
+namespace WorldAPI {
+
+void BoxSoA::Clear() {
+    m_size = 0;
+    m_minX.clear(); m_minY.clear(); m_minZ.clear();
+    m_maxX.clear(); m_maxY.clear(); m_maxZ.clear();
+}
+
+void BoxSoA::Reserve(size_t count) {
+    const size_t capacity = count + KERNEL_WIDTH - 1;
+    m_minX.reserve(capacity); m_minY.reserve(capacity); m_minZ.reserve(capacity);
+    m_maxX.reserve(capacity); m_maxY.reserve(capacity); m_maxZ.reserve(capacity);
+}
+
+void BoxSoA::Push(const float mins[3], const float maxs[3]) {
+    // Overwrite the padding tail, then restore it
+    m_minX.resize(m_size); m_minY.resize(m_size); m_minZ.resize(m_size);
+    m_maxX.resize(m_size); m_maxY.resize(m_size); m_maxZ.resize(m_size);
+
+    m_minX.push_back(mins[0]); m_minY.push_back(mins[1]); m_minZ.push_back(mins[2]);
+    m_maxX.push_back(maxs[0]); m_maxY.push_back(maxs[1]); m_maxZ.push_back(maxs[2]);
+    ++m_size;
+    Pad();
+}
+
+void BoxSoA::Pad() {
+    const size_t padded = m_size + KERNEL_WIDTH - 1;
+    m_minX.resize(padded, 0.0f); m_minY.resize(padded, 0.0f); m_minZ.resize(padded, 0.0f);
+    m_maxX.resize(padded, 0.0f); m_maxY.resize(padded, 0.0f); m_maxZ.resize(padded, 0.0f);
+}
+
+#ifdef WORLDAPI_CULL_SSE
+
+uint32_t CullBoxGroup(const BoxSoA& boxes, size_t first, size_t count, const CullParams& params) {
+    if (count == 0) return 0;
+
+    const __m128 minX = _mm_loadu_ps(boxes.MinX() + first);
+    const __m128 minY = _mm_loadu_ps(boxes.MinY() + first);
+    const __m128 minZ = _mm_loadu_ps(boxes.MinZ() + first);
+    const __m128 maxX = _mm_loadu_ps(boxes.MaxX() + first);
+    const __m128 maxY = _mm_loadu_ps(boxes.MaxY() + first);
+    const __m128 maxZ = _mm_loadu_ps(boxes.MaxZ() + first);
+
+    __m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+    if (params.frustum) {
+        const __m128 zero = _mm_setzero_ps();
+        for (const auto& plane : params.frustum->planes) {
+            // Corner furthest along the normal; the choice is the same for every box
+            const __m128 px = plane[0] >= 0.0f ? maxX : minX;
+            const __m128 py = plane[1] >= 0.0f ? maxY : minY;
+            const __m128 pz = plane[2] >= 0.0f ? maxZ : minZ;
+
+            __m128 dist = _mm_mul_ps(px, _mm_set1_ps(plane[0]));
+            dist = _mm_add_ps(dist, _mm_mul_ps(py, _mm_set1_ps(plane[1])));
+            dist = _mm_add_ps(dist, _mm_mul_ps(pz, _mm_set1_ps(plane[2])));
+            dist = _mm_sub_ps(dist, _mm_set1_ps(plane[3]));
+            visible = _mm_and_ps(visible, _mm_cmpge_ps(dist, zero));
+        }
+    }
+
+    if (params.maxDistance > 0.0f) {
+        const __m128 half = _mm_set1_ps(0.5f);
+        const __m128 dx = _mm_sub_ps(_mm_mul_ps(_mm_add_ps(minX, maxX), half), _mm_set1_ps(params.origin[0]));
+        const __m128 dy = _mm_sub_ps(_mm_mul_ps(_mm_add_ps(minY, maxY), half), _mm_set1_ps(params.origin[1]));
+        const __m128 dz = _mm_sub_ps(_mm_mul_ps(_mm_add_ps(minZ, maxZ), half), _mm_set1_ps(params.origin[2]));
+        __m128 distSq = _mm_mul_ps(dx, dx);
+        distSq = _mm_add_ps(distSq, _mm_mul_ps(dy, dy));
+        distSq = _mm_add_ps(distSq, _mm_mul_ps(dz, dz));
+        visible = _mm_and_ps(visible, _mm_cmple_ps(distSq, _mm_set1_ps(params.maxDistance * params.maxDistance)));
+    }
+
+    const uint32_t lanes = count >= BoxSoA::KERNEL_WIDTH ? 0xFu : ((1u << count) - 1u);
+    return static_cast<uint32_t>(_mm_movemask_ps(visible)) & lanes;
+}
+
+#else
+
+uint32_t CullBoxGroup(const BoxSoA& boxes, size_t first, size_t count, const CullParams& params) {
+    const float maxDistanceSq = params.maxDistance * params.maxDistance;
+    uint32_t mask = 0;
+
+    for (size_t lane = 0; lane < count && lane < BoxSoA::KERNEL_WIDTH; ++lane) {
+        const size_t i = first + lane;
+        const float mins[3] = { boxes.MinX()[i], boxes.MinY()[i], boxes.MinZ()[i] };
+        const float maxs[3] = { boxes.MaxX()[i], boxes.MaxY()[i], boxes.MaxZ()[i] };
+
+        if (params.frustum && !params.frustum->IntersectsBox(mins, maxs)) continue;
+        if (params.maxDistance > 0.0f) {
+            float distSq = 0.0f;
+            for (int axis = 0; axis < 3; ++axis) {
+                const float d = (mins[axis] + maxs[axis]) * 0.5f - params.origin[axis];
+                distSq += d * d;
+            }
+            if (distSq > maxDistanceSq) continue;
+        }
+        mask |= 1u << lane;
+    }
+    return mask;
+}
+
+#endif
+
+size_t CullBoxes(const BoxSoA& boxes, const CullParams& params, std::vector<uint32_t>& outMask) {
+    const size_t count = boxes.Size();
+    outMask.assign((count + 31) / 32, 0u);
+
+    size_t visibleCount = 0;
+    for (size_t first = 0; first < count; first += BoxSoA::KERNEL_WIDTH) {
+        const uint32_t bits = CullBoxGroup(boxes, first, count - first, params);
+        if (!bits) continue;
+
+        // KERNEL_WIDTH divides 32, so a group never straddles two words
+        outMask[first / 32] |= bits << (first % 32);
+        for (uint32_t b = bits; b; b &= b - 1) ++visibleCount;
+    }
+    return visibleCount;
+}
+
+} // namespace WorldAPI
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WORLDAPI_CULL_SSE 1
+#endif
+
+namespace WorldAPI {
+
+    struct Frustum;
+
+    // Structure-of-arrays AABB storage for the culling kernel. Every array carries at least
+    // KERNEL_WIDTH - 1 padding entries past the end, so a 4-wide load may start at any index.
+    class BoxSoA {
+    public:
+        static constexpr size_t KERNEL_WIDTH = 4;
+
+        void Clear();
+        void Reserve(size_t count);
+        void Push(const float mins[3], const float maxs[3]);
+
+        size_t Size() const { return m_size; }
+
+        const float* MinX() const { return m_minX.data(); }
+        const float* MinY() const { return m_minY.data(); }
+        const float* MinZ() const { return m_minZ.data(); }
+        const float* MaxX() const { return m_maxX.data(); }
+        const float* MaxY() const { return m_maxY.data(); }
+        const float* MaxZ() const { return m_maxZ.data(); }
+
+    private:
+        void Pad();
+
+        size_t m_size = 0;
+        std::vector<float> m_minX, m_minY, m_minZ;
+        std::vector<float> m_maxX, m_maxY, m_maxZ;
+    };
+
+    // What a box must satisfy to be visible: inside the frustum (if set) and with its centre
+    // within maxDistance of origin (if maxDistance > 0)
+    struct CullParams {
+        const Frustum* frustum = nullptr;
+        float origin[3] = { 0, 0, 0 };
+        float maxDistance = 0.0f;
+    };
+
+    // Tests up to KERNEL_WIDTH boxes starting at first; bit i of the result is box first + i.
+    // Bits past count are always clear.
+    uint32_t CullBoxGroup(const BoxSoA& boxes, size_t first, size_t count, const CullParams& params);
+
+    // Tests every box and writes a visibility bitmask (bit i of word i / 32 is box i).
+    // Returns the number of visible boxes.
+    size_t CullBoxes(const BoxSoA& boxes, const CullParams& params, std::vector<uint32_t>& outMask);
+
+} // namespace WorldAPI
@@ -0,0 +1,285 @@
+#include "worldapi.h"
+#include <tier0/dbg.h>
+#include <mathlib/vector.h>
+
+using namespace GarrysMod::Lua;
+
+namespace WorldAPI {
+
+static CullManager& Cull() {
+    return WorldAPI::Instance().GetCullManager();
+}
+
+static void PushIdArray(ILuaBase* LUA, const std::vector<uint32_t>& ids) {
+    LUA->CreateTable();
+    for (size_t i = 0; i < ids.size(); ++i) {
+        LUA->PushNumber(static_cast<double>(i + 1));
+        LUA->PushNumber(static_cast<double>(ids[i]));
+        LUA->SetTable(-3);
+    }
+}
+
+static void PushIdSet(ILuaBase* LUA, const std::vector<uint32_t>& ids) {
+    LUA->CreateTable();
+    for (uint32_t id : ids) {
+        LUA->PushNumber(static_cast<double>(id));
+        LUA->PushBool(true);
+        LUA->SetTable(-3);
+    }
+}
+
+// Reads array[i] as a Vector (top of stack is left unchanged); false if it is missing
+static bool GetArrayVector(ILuaBase* LUA, int tableIndex, size_t i, float out[3]) {
+    LUA->PushNumber(static_cast<double>(i));
+    LUA->GetTable(tableIndex);
+    const bool ok = LUA->IsType(-1, Type::Vector);
+    if (ok) {
+        const Vector& v = LUA->GetVector(-1);
+        out[0] = v.x; out[1] = v.y; out[2] = v.z;
+    }
+    LUA->Pop();
+    return ok;
+}
+
+// Shared by Query/QuerySet: (name, distanceOrigin?, maxDistance?) against the current view
+static bool RunQuery(ILuaBase* LUA, std::vector<uint32_t>& ids) {
+    if (!LUA->IsType(1, Type::String)) {
+        LUA->ThrowError("Expected index name");
+        return false;
+    }
+
+    SpatialIndex* index = Cull().FindIndex(LUA->GetString(1));
+    if (!index) return true;
+
+    float origin[3] = { 0, 0, 0 };
+    float maxDistance = 0.0f;
+    if (LUA->IsType(2, Type::Vector) && LUA->IsType(3, Type::Number)) {
+        const Vector& pos = LUA->GetVector(2);
+        origin[0] = pos.x; origin[1] = pos.y; origin[2] = pos.z;
+        maxDistance = static_cast<float>(LUA->GetNumber(3));
+    }
+
+    index->Query(Cull().GetView(), maxDistance > 0.0f ? origin : nullptr, maxDistance, ids);
+    return true;
+}
+
+// Lua function: RemixCull.SetView(origin, angles, fov, aspect)
+LUA_FUNCTION(RemixCull_SetView) {
+    if (!LUA->IsType(1, Type::Vector) || !LUA->IsType(2, Type::Angle) || !LUA->IsType(3, Type::Number)) {
+        LUA->ThrowError("Expected Vector origin, Angle angles and number fov");
+        return 0;
+    }
+
+    const Vector& pos = LUA->GetVector(1);
+    const float origin[3] = { pos.x, pos.y, pos.z };
+    const QAngle& ang = LUA->GetAngle(2);
+    const float angles[3] = { ang.x, ang.y, ang.z };
+    const float fov = static_cast<float>(LUA->GetNumber(3));
+    const float aspect = LUA->IsType(4, Type::Number) ? static_cast<float>(LUA->GetNumber(4)) : 16.0f / 9.0f;
+
+    Cull().SetView(Frustum::FromView(origin, angles, fov, aspect));
+    return 0;
+}
+
+// Lua function: RemixCull.AddItem(name, id, mins, maxs)
+LUA_FUNCTION(RemixCull_AddItem) {
+    if (!LUA->IsType(1, Type::String) || !LUA->IsType(2, Type::Number) ||
+        !LUA->IsType(3, Type::Vector) || !LUA->IsType(4, Type::Vector)) {
+        LUA->ThrowError("Expected index name, numeric id and Vector mins/maxs");
+        return 0;
+    }
+
+    const Vector& mins = LUA->GetVector(3);
+    const float boxMins[3] = { mins.x, mins.y, mins.z };
+    const Vector& maxs = LUA->GetVector(4);
+    const float boxMaxs[3] = { maxs.x, maxs.y, maxs.z };
+
+    Cull().GetIndex(LUA->GetString(1)).Add(static_cast<uint32_t>(LUA->GetNumber(2)), boxMins, boxMaxs);
+    return 0;
+}
+
+// Lua function: RemixCull.AddItems(name, ids, mins, maxs) -> count
+// Bulk form of AddItem taking parallel arrays; stops at the first missing entry.
+LUA_FUNCTION(RemixCull_AddItems) {
+    if (!LUA->IsType(1, Type::String) || !LUA->IsType(2, Type::Table) ||
+        !LUA->IsType(3, Type::Table) || !LUA->IsType(4, Type::Table)) {
+        LUA->ThrowError("Expected index name and id, mins and maxs arrays");
+        return 0;
+    }
+
+    SpatialIndex& index = Cull().GetIndex(LUA->GetString(1));
+    size_t added = 0;
+    for (size_t i = 1;; ++i) {
+        LUA->PushNumber(static_cast<double>(i));
+        LUA->GetTable(2);
+        if (!LUA->IsType(-1, Type::Number)) {
+            LUA->Pop();
+            break;
+        }
+        const uint32_t id = static_cast<uint32_t>(LUA->GetNumber(-1));
+        LUA->Pop();
+
+        float mins[3], maxs[3];
+        if (!GetArrayVector(LUA, 3, i, mins) || !GetArrayVector(LUA, 4, i, maxs)) break;
+
+        index.Add(id, mins, maxs);
+        ++added;
+    }
+
+    LUA->PushNumber(static_cast<double>(added));
+    return 1;
+}
+
+// Lua function: RemixCull.TestBoxes(mins, maxs, distanceOrigin, maxDistance) -> { [i] = true }
+// One-shot test of parallel mins/maxs arrays against the current view, for box lists that
+// change too often to keep in an index. Runs the SIMD kernel over the whole list.
+LUA_FUNCTION(RemixCull_TestBoxes) {
+    if (!LUA->IsType(1, Type::Table) || !LUA->IsType(2, Type::Table)) {
+        LUA->ThrowError("Expected mins and maxs arrays");
+        return 0;
+    }
+
+    BoxSoA boxes;
+    boxes.Reserve(LUA->ObjLen(1));
+    for (size_t i = 1;; ++i) {
+        float mins[3], maxs[3];
+        if (!GetArrayVector(LUA, 1, i, mins) || !GetArrayVector(LUA, 2, i, maxs)) break;
+        boxes.Push(mins, maxs);
+    }
+
+    CullParams params;
+    params.frustum = Cull().GetView();
+    if (LUA->IsType(3, Type::Vector) && LUA->IsType(4, Type::Number)) {
+        const Vector& pos = LUA->GetVector(3);
+        params.origin[0] = pos.x; params.origin[1] = pos.y; params.origin[2] = pos.z;
+        params.maxDistance = static_cast<float>(LUA->GetNumber(4));
+    }
+
+    std::vector<uint32_t> mask;
+    CullBoxes(boxes, params, mask);
+
+    LUA->CreateTable();
+    for (size_t word = 0; word < mask.size(); ++word) {
+        for (uint32_t bits = mask[word]; bits; bits &= bits - 1) {
+            uint32_t bit = 0;
+            while (!(bits & (1u << bit))) ++bit;
+            LUA->PushNumber(static_cast<double>(word * 32 + bit + 1));
+            LUA->PushBool(true);
+            LUA->SetTable(-3);
+        }
+    }
+    return 1;
+}
+
+// Lua function: RemixCull.ClearIndex(name)
+LUA_FUNCTION(RemixCull_ClearIndex) {
+    if (!LUA->IsType(1, Type::String)) {
+        LUA->ThrowError("Expected index name");
+        return 0;
+    }
+
+    Cull().ClearIndex(LUA->GetString(1));
+    return 0;
+}
+
+// Lua function: RemixCull.Query(name, distanceOrigin, maxDistance) -> { id, ... }
+// Returns the ids inside the current view (and within maxDistance of distanceOrigin if given).
+LUA_FUNCTION(RemixCull_Query) {
+    std::vector<uint32_t> ids;
+    if (!RunQuery(LUA, ids)) return 0;
+
+    PushIdArray(LUA, ids);
+    return 1;
+}
+
+// Lua function: RemixCull.QuerySet(name, distanceOrigin, maxDistance) -> { [id] = true }
+LUA_FUNCTION(RemixCull_QuerySet) {
+    std::vector<uint32_t> ids;
+    if (!RunQuery(LUA, ids)) return 0;
+
+    PushIdSet(LUA, ids);
+    return 1;
+}
+
+// Lua function: RemixCull.QuerySphere(name, center, radius) -> { id, ... }
+// Ignores the view; used for light and proximity lookups.
+LUA_FUNCTION(RemixCull_QuerySphere) {
+    if (!LUA->IsType(1, Type::String) || !LUA->IsType(2, Type::Vector) || !LUA->IsType(3, Type::Number)) {
+        LUA->ThrowError("Expected index name, Vector center and number radius");
+        return 0;
+    }
+
+    std::vector<uint32_t> ids;
+    if (SpatialIndex* index = Cull().FindIndex(LUA->GetString(1))) {
+        const Vector& pos = LUA->GetVector(2);
+        const float center[3] = { pos.x, pos.y, pos.z };
+        index->QuerySphere(center, static_cast<float>(LUA->GetNumber(3)), ids);
+    }
+
+    PushIdArray(LUA, ids);
+    return 1;
+}
+
+// Lua function: RemixCull.GetInfo(name) -> { items, nodes } or nil
+LUA_FUNCTION(RemixCull_GetInfo) {
+    if (!LUA->IsType(1, Type::String)) {
+        LUA->ThrowError("Expected index name");
+        return 0;
+    }
+
+    SpatialIndex* index = Cull().FindIndex(LUA->GetString(1));
+    if (!index) {
+        LUA->PushNil();
+        return 1;
+    }
+
+    index->Build();
+    LUA->CreateTable();
+    LUA->PushNumber(static_cast<double>(index->GetItemCount())); LUA->SetField(-2, "items");
+    LUA->PushNumber(static_cast<double>(index->GetNodeCount())); LUA->SetField(-2, "nodes");
+    return 1;
+}
+
+void CullManager::InitializeLuaBindings() {
+    m_lua->PushSpecial(GarrysMod::Lua::SPECIAL_GLOB);
+
+    // Create RemixCull table
+    m_lua->CreateTable();
+
+    m_lua->PushCFunction(RemixCull_SetView);
+    m_lua->SetField(-2, "SetView");
+
+    m_lua->PushCFunction(RemixCull_AddItem);
+    m_lua->SetField(-2, "AddItem");
+
+    m_lua->PushCFunction(RemixCull_AddItems);
+    m_lua->SetField(-2, "AddItems");
+
+    m_lua->PushCFunction(RemixCull_TestBoxes);
+    m_lua->SetField(-2, "TestBoxes");
+
+    m_lua->PushCFunction(RemixCull_ClearIndex);
+    m_lua->SetField(-2, "ClearIndex");
+
+    m_lua->PushCFunction(RemixCull_Query);
+    m_lua->SetField(-2, "Query");
+
+    m_lua->PushCFunction(RemixCull_QuerySet);
+    m_lua->SetField(-2, "QuerySet");
+
+    m_lua->PushCFunction(RemixCull_QuerySphere);
+    m_lua->SetField(-2, "QuerySphere");
+
+    m_lua->PushCFunction(RemixCull_GetInfo);
+    m_lua->SetField(-2, "GetInfo");
+
+    // Set the table as a global field
+    m_lua->SetField(-2, "RemixCull");
+
+    // Pop the global table
+    m_lua->Pop();
+
+    Msg("[CullManager] Lua bindings initialized\n");
+}
+
+} // namespace WorldAPI
@@ -0,0 +1,315 @@
+#include "displacement_builder.h"
+#include "material_filter.h"
+#include "vertex_kernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <tuple>
+
+namespace WorldAPI {
+
+namespace {
+
+    constexpr int MIN_DISP_POWER = 2;
+    constexpr int MAX_DISP_POWER = 4;
+    constexpr int MAX_DISP_SIZE = (1 << MAX_DISP_POWER) + 1;
+    constexpr int MAX_DISP_VERTS = MAX_DISP_SIZE * MAX_DISP_SIZE;
+
+    struct GroupKey {
+        int32_t x, y, z;
+        std::string material;
+
+        bool operator<(const GroupKey& o) const {
+            return std::tie(x, y, z, material) < std::tie(o.x, o.y, o.z, o.material);
+        }
+    };
+
+    inline void Cross(const float a[3], const float b[3], float out[3]) {
+        out[0] = a[1] * b[2] - a[2] * b[1];
+        out[1] = a[2] * b[0] - a[0] * b[2];
+        out[2] = a[0] * b[1] - a[1] * b[0];
+    }
+
+    // Structure-of-arrays grid so the per-row interpolation loops vectorise
+    struct DispGrid {
+        float baseX[MAX_DISP_VERTS], baseY[MAX_DISP_VERTS], baseZ[MAX_DISP_VERTS];
+        float posX[MAX_DISP_VERTS], posY[MAX_DISP_VERTS], posZ[MAX_DISP_VERTS];
+        float normX[MAX_DISP_VERTS], normY[MAX_DISP_VERTS], normZ[MAX_DISP_VERTS];
+    };
+
+} // namespace
+
+bool TessellateDisplacement(const BSPFile& map, size_t dispIndex,
+                            std::vector<MeshVertex>& outVertices, std::vector<uint8_t>& outAlphas) {
+    auto dispInfos = map.DispInfo();
+    auto dispVerts = map.DispVerts();
+    auto faces = map.Faces();
+    auto planes = map.Planes();
+    auto texInfos = map.TexInfo();
+    auto texDatas = map.TexData();
+    if (!dispInfos.valid(static_cast<int64_t>(dispIndex))) return false;
+
+    const BSPDispInfo& disp = dispInfos[dispIndex];
+    if (disp.power < MIN_DISP_POWER || disp.power > MAX_DISP_POWER) return false;
+    if (!faces.valid(disp.mapFace)) return false;
+
+    const BSPFace& face = faces[disp.mapFace];
+    if (face.numedges != 4 || !planes.valid(face.planenum) || !texInfos.valid(face.texinfo)) return false;
+
+    const int size = (1 << disp.power) + 1;
+    const int count = size * size;
+    if (disp.dispVertStart < 0 || !dispVerts.valid(static_cast<int64_t>(disp.dispVertStart) + count - 1)) return false;
+
+    // The grid starts at the face corner nearest to startPosition
+    float corners[4][3];
+    int start = 0;
+    float bestDistance = std::numeric_limits<float>::max();
+    for (int c = 0; c < 4; ++c) {
+        BSPVector pos;
+        if (!map.GetFaceVertex(face, c, pos)) return false;
+        corners[c][0] = pos.x; corners[c][1] = pos.y; corners[c][2] = pos.z;
+
+        const float dx = pos.x - disp.startPosition.x;
+        const float dy = pos.y - disp.startPosition.y;
+        const float dz = pos.z - disp.startPosition.z;
+        const float distance = dx * dx + dy * dy + dz * dz;
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            start = c;
+        }
+    }
+
+    const float* p0 = corners[start];
+    const float* p1 = corners[(start + 1) % 4];
+    const float* p2 = corners[(start + 2) % 4];
+    const float* p3 = corners[(start + 3) % 4];
+
+    thread_local DispGrid grid;
+    const float step = 1.0f / static_cast<float>(size - 1);
+
+    // Flat base grid: rows run p0 -> p1 on one side and p3 -> p2 on the other
+    for (int i = 0; i < size; ++i) {
+        const float t = static_cast<float>(i) * step;
+        const float startX = p0[0] + (p1[0] - p0[0]) * t, endX = p3[0] + (p2[0] - p3[0]) * t;
+        const float startY = p0[1] + (p1[1] - p0[1]) * t, endY = p3[1] + (p2[1] - p3[1]) * t;
+        const float startZ = p0[2] + (p1[2] - p0[2]) * t, endZ = p3[2] + (p2[2] - p3[2]) * t;
+
+        float* baseX = grid.baseX + i * size;
+        float* baseY = grid.baseY + i * size;
+        float* baseZ = grid.baseZ + i * size;
+        for (int j = 0; j < size; ++j) {
+            const float s = static_cast<float>(j) * step;
+            baseX[j] = startX + (endX - startX) * s;
+            baseY[j] = startY + (endY - startY) * s;
+            baseZ[j] = startZ + (endZ - startZ) * s;
+        }
+    }
+
+    // Displace along each vertex's offset direction
+    for (int v = 0; v < count; ++v) {
+        const BSPDispVert& dispVert = dispVerts[static_cast<size_t>(disp.dispVertStart) + v];
+        grid.posX[v] = grid.baseX[v] + dispVert.vec.x * dispVert.dist;
+        grid.posY[v] = grid.baseY[v] + dispVert.vec.y * dispVert.dist;
+        grid.posZ[v] = grid.baseZ[v] + dispVert.vec.z * dispVert.dist;
+    }
+
+    for (int v = 0; v < count; ++v) {
+        if (std::isnan(grid.posX[v]) || std::isnan(grid.posY[v]) || std::isnan(grid.posZ[v]) ||
+            std::fabs(grid.posX[v]) > BSP_MAX_COORD || std::fabs(grid.posY[v]) > BSP_MAX_COORD ||
+            std::fabs(grid.posZ[v]) > BSP_MAX_COORD) {
+            return false;
+        }
+    }
+
+    // Triangles alternate their diagonal per quad like the engine's own tessellation
+    int triangles[(MAX_DISP_SIZE - 1) * (MAX_DISP_SIZE - 1) * 2][3];
+    int triangleCount = 0;
+    for (int i = 0; i < size - 1; ++i) {
+        for (int j = 0; j < size - 1; ++j) {
+            const int index = i * size + j;
+            if (index % 2) {
+                triangles[triangleCount][0] = index; triangles[triangleCount][1] = index + size; triangles[triangleCount][2] = index + 1; ++triangleCount;
+                triangles[triangleCount][0] = index + 1; triangles[triangleCount][1] = index + size; triangles[triangleCount][2] = index + size + 1; ++triangleCount;
+            } else {
+                triangles[triangleCount][0] = index; triangles[triangleCount][1] = index + size; triangles[triangleCount][2] = index + size + 1; ++triangleCount;
+                triangles[triangleCount][0] = index; triangles[triangleCount][1] = index + size + 1; triangles[triangleCount][2] = index + 1; ++triangleCount;
+            }
+        }
+    }
+
+    // Match the winding of the base face so displacements face the same way as brushes
+    const BSPPlane& plane = planes[face.planenum];
+    const float sign = face.side ? -1.0f : 1.0f;
+    const float faceNormal[3] = { plane.normal.x * sign, plane.normal.y * sign, plane.normal.z * sign };
+    {
+        const int* tri = triangles[0];
+        const float e1[3] = { grid.baseX[tri[1]] - grid.baseX[tri[0]], grid.baseY[tri[1]] - grid.baseY[tri[0]], grid.baseZ[tri[1]] - grid.baseZ[tri[0]] };
+        const float e2[3] = { grid.baseX[tri[2]] - grid.baseX[tri[0]], grid.baseY[tri[2]] - grid.baseY[tri[0]], grid.baseZ[tri[2]] - grid.baseZ[tri[0]] };
+        float n[3];
+        Cross(e1, e2, n);
+        if (n[0] * faceNormal[0] + n[1] * faceNormal[1] + n[2] * faceNormal[2] < 0.0f) {
+            for (int t = 0; t < triangleCount; ++t) std::swap(triangles[t][1], triangles[t][2]);
+        }
+    }
+
+    // Area-weighted smooth normals over the displaced surface
+    std::fill(grid.normX, grid.normX + count, 0.0f);
+    std::fill(grid.normY, grid.normY + count, 0.0f);
+    std::fill(grid.normZ, grid.normZ + count, 0.0f);
+    for (int t = 0; t < triangleCount; ++t) {
+        const int* tri = triangles[t];
+        const float e1[3] = { grid.posX[tri[1]] - grid.posX[tri[0]], grid.posY[tri[1]] - grid.posY[tri[0]], grid.posZ[tri[1]] - grid.posZ[tri[0]] };
+        const float e2[3] = { grid.posX[tri[2]] - grid.posX[tri[0]], grid.posY[tri[2]] - grid.posY[tri[0]], grid.posZ[tri[2]] - grid.posZ[tri[0]] };
+        float n[3];
+        Cross(e1, e2, n);
+        for (int k = 0; k < 3; ++k) {
+            grid.normX[tri[k]] += n[0];
+            grid.normY[tri[k]] += n[1];
+            grid.normZ[tri[k]] += n[2];
+        }
+    }
+
+    // Texture coordinates come from the undisplaced base face, as in the engine
+    const BSPTexInfo& texInfo = texInfos[face.texinfo];
+    float width = 1.0f, height = 1.0f;
+    if (texDatas.valid(texInfo.texdata)) {
+        const BSPTexData& texData = texDatas[texInfo.texdata];
+        if (texData.width > 0) width = static_cast<float>(texData.width);
+        if (texData.height > 0) height = static_cast<float>(texData.height);
+    }
+    const float* sVec = texInfo.textureVecs[0];
+    const float* tVec = texInfo.textureVecs[1];
+
+    outVertices.reserve(outVertices.size() + static_cast<size_t>(triangleCount) * 3);
+    outAlphas.reserve(outAlphas.size() + static_cast<size_t>(triangleCount) * 3);
+    for (int t = 0; t < triangleCount; ++t) {
+        for (int k = 0; k < 3; ++k) {
+            const int v = triangles[t][k];
+            MeshVertex vertex;
+            vertex.pos[0] = grid.posX[v]; vertex.pos[1] = grid.posY[v]; vertex.pos[2] = grid.posZ[v];
+
+            const float length = std::sqrt(grid.normX[v] * grid.normX[v] + grid.normY[v] * grid.normY[v] + grid.normZ[v] * grid.normZ[v]);
+            if (length > 1e-6f) {
+                vertex.normal[0] = grid.normX[v] / length;
+                vertex.normal[1] = grid.normY[v] / length;
+                vertex.normal[2] = grid.normZ[v] / length;
+            } else {
+                vertex.normal[0] = faceNormal[0]; vertex.normal[1] = faceNormal[1]; vertex.normal[2] = faceNormal[2];
+            }
+
+            const float bx = grid.baseX[v], by = grid.baseY[v], bz = grid.baseZ[v];
+            vertex.uv[0] = (bx * sVec[0] + by * sVec[1] + bz * sVec[2] + sVec[3]) / width;
+            vertex.uv[1] = (bx * tVec[0] + by * tVec[1] + bz * tVec[2] + tVec[3]) / height;
+            outVertices.push_back(vertex);
+
+            const float alpha = dispVerts[static_cast<size_t>(disp.dispVertStart) + v].alpha;
+            outAlphas.push_back(static_cast<uint8_t>(std::clamp(alpha, 0.0f, 255.0f)));
+        }
+    }
+    return true;
+}
+
+DisplacementBuildResult BuildDisplacements(const BSPFile& map, const DisplacementBuildSettings& settings, ThreadPool& pool,
+                                           BuildProgress* progress) {
+    DisplacementBuildResult result;
+    result.binSize = settings.binSize > 0 ? settings.binSize : 8192;
+
+    auto dispInfos = map.DispInfo();
+    auto faces = map.Faces();
+    auto texInfos = map.TexInfo();
+    if (dispInfos.empty()) return result;
+
+    const double binSize = static_cast<double>(result.binSize);
+    const MaterialFilter filter(settings.whitelist, settings.blacklist);
+
+    // Filter verdict per texinfo: -1 unknown, 0 rejected, 1 allowed
+    std::vector<int8_t> texInfoVerdict(texInfos.size(), -1);
+    std::map<GroupKey, size_t> groupLookup;
+
+    for (size_t d = 0; d < dispInfos.size(); ++d) {
+        const BSPDispInfo& disp = dispInfos[d];
+        if (!faces.valid(disp.mapFace) || !texInfos.valid(faces[disp.mapFace].texinfo)) {
+            ++result.rejectedDisplacements;
+            continue;
+        }
+
+        const BSPFace& face = faces[disp.mapFace];
+        int8_t& verdict = texInfoVerdict[face.texinfo];
+        if (verdict < 0) {
+            const std::string_view name = map.GetFaceMaterial(face);
+            verdict = (!name.empty() && filter.IsAllowed(name)) ? 1 : 0;
+        }
+        if (verdict == 0) {
+            ++result.rejectedDisplacements;
+            continue;
+        }
+
+        // Bin by the base face centre
+        double center[3] = { 0, 0, 0 };
+        int corners = 0;
+        for (int c = 0; c < face.numedges; ++c) {
+            BSPVector pos;
+            if (!map.GetFaceVertex(face, c, pos)) continue;
+            center[0] += pos.x; center[1] += pos.y; center[2] += pos.z;
+            ++corners;
+        }
+        if (corners == 0) {
+            ++result.rejectedDisplacements;
+            continue;
+        }
+
+        GroupKey key {
+            static_cast<int32_t>(std::floor(center[0] / corners / binSize)),
+            static_cast<int32_t>(std::floor(center[1] / corners / binSize)),
+            static_cast<int32_t>(std::floor(center[2] / corners / binSize)),
+            std::string(map.GetFaceMaterial(face))
+        };
+
+        auto it = groupLookup.find(key);
+        if (it == groupLookup.end()) {
+            it = groupLookup.emplace(std::move(key), result.groups.size()).first;
+            DisplacementGroup created;
+            created.bin[0] = it->first.x;
+            created.bin[1] = it->first.y;
+            created.bin[2] = it->first.z;
+            created.material = it->first.material;
+            result.groups.push_back(std::move(created));
+        }
+        result.groups[it->second].displacements.push_back(static_cast<uint32_t>(d));
+    }
+
+    std::vector<size_t> invalidDisplacements(result.groups.size(), 0);
+    if (progress) progress->SetTotal(result.groups.size());
+    pool.ParallelFor(result.groups.size(), [&](size_t g) {
+        if (progress && progress->IsCancelled()) return;
+        DisplacementGroup& group = result.groups[g];
+        for (uint32_t dispIndex : group.displacements) {
+            if (!TessellateDisplacement(map, dispIndex, group.vertices, group.alphas)) ++invalidDisplacements[g];
+        }
+
+        // Every vertex already passed validation, so this is only the bounds pass
+        VertexBounds bounds;
+        ValidatePositions(group.vertices.empty() ? nullptr : group.vertices[0].pos, group.vertices.size(),
+                          sizeof(MeshVertex) / sizeof(float), bounds);
+        for (int axis = 0; axis < 3; ++axis) {
+            group.mins[axis] = group.vertices.empty() ? 0.0f : bounds.mins[axis];
+            group.maxs[axis] = group.vertices.empty() ? 0.0f : bounds.maxs[axis];
+        }
+        if (progress) progress->Advance();
+    });
+
+    for (size_t g = 0; g < result.groups.size(); ++g) {
+        result.displacementCount += result.groups[g].displacements.size() - invalidDisplacements[g];
+        result.rejectedDisplacements += invalidDisplacements[g];
+    }
+
+    // Drop groups whose displacements were all invalid
+    result.groups.erase(std::remove_if(result.groups.begin(), result.groups.end(),
+        [](const DisplacementGroup& group) { return group.vertices.empty(); }), result.groups.end());
+
+    return result;
+}
+
+} // namespace WorldAPI
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "bsp_file.h"
+#include "build_progress.h"
+#include "mesh_simplifier.h"
+#include "thread_pool.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace WorldAPI {
+
+    struct DisplacementBuildSettings {
+        // Spatial bin edge length in units (rtx_cdr_bin_size)
+        int binSize = 8192;
+        std::string whitelist;
+        std::string blacklist;
+        // Reuse/refresh the on-disk geometry cache (data/remixworld/)
+        bool useCache = true;
+    };
+
+    // All displacements of one material inside one spatial bin, merged into a single triangle list
+    struct DisplacementGroup {
+        int32_t bin[3] = { 0, 0, 0 };
+        std::string material;
+        float mins[3] = { 0, 0, 0 };
+        float maxs[3] = { 0, 0, 0 };
+        std::vector<uint32_t> displacements; // dispinfo indices
+        // Triangle list (3 vertices per triangle) with the per-vertex blend alpha alongside
+        std::vector<MeshVertex> vertices;
+        std::vector<uint8_t> alphas;
+    };
+
+    struct DisplacementBuildResult {
+        int binSize = 0;
+        size_t displacementCount = 0;
+        size_t rejectedDisplacements = 0;
+        std::vector<DisplacementGroup> groups;
+    };
+
+    // Appends the triangulated (2^power + 1)^2 grid of one displacement: displaced positions,
+    // smoothed vertex normals, base-face texture UVs and the dispvert blend alpha.
+    // Returns false without appending for malformed displacements or out-of-range vertices.
+    bool TessellateDisplacement(const BSPFile& map, size_t dispIndex,
+                                std::vector<MeshVertex>& outVertices, std::vector<uint8_t>& outAlphas);
+
+    // Native replacement for CreateDispMeshes: filters displacements by material, bins them by
+    // base-face centre and tessellates every (bin, material) group in parallel. Progress and
+    // cancellation work as in BuildWorldChunks.
+    DisplacementBuildResult BuildDisplacements(const BSPFile& map, const DisplacementBuildSettings& settings, ThreadPool& pool,
+                                               BuildProgress* progress = nullptr);
+
+} // namespace WorldAPI
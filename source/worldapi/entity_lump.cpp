@@ -0,0 +1,81 @@
+#include "entity_lump.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace WorldAPI {
+
+namespace {
+
+    inline bool EqualsNoCase(std::string_view a, std::string_view b) {
+        if (a.size() != b.size()) return false;
+        for (size_t i = 0; i < a.size(); ++i) {
+            char ca = a[i], cb = b[i];
+            if (ca >= 'A' && ca <= 'Z') ca = static_cast<char>(ca - 'A' + 'a');
+            if (cb >= 'A' && cb <= 'Z') cb = static_cast<char>(cb - 'A' + 'a');
+            if (ca != cb) return false;
+        }
+        return true;
+    }
+
+    // Reads the next quoted string; returns false at a brace or the end of the text
+    bool ReadQuoted(std::string_view text, size_t& pos, std::string& out) {
+        while (pos < text.size() && text[pos] != '"' && text[pos] != '{' && text[pos] != '}') ++pos;
+        if (pos >= text.size() || text[pos] != '"') return false;
+
+        const size_t start = ++pos;
+        while (pos < text.size() && text[pos] != '"') ++pos;
+        if (pos >= text.size()) return false;
+
+        out.assign(text.data() + start, pos - start);
+        ++pos;
+        return true;
+    }
+
+} // namespace
+
+std::string_view BSPEntity::Get(std::string_view key, std::string_view fallback) const {
+    for (const auto& kv : keyValues) {
+        if (EqualsNoCase(kv.first, key)) return kv.second;
+    }
+    return fallback;
+}
+
+bool BSPEntity::GetVector(std::string_view key, float out[3]) const {
+    const std::string value(Get(key));
+    if (value.empty()) return false;
+    return std::sscanf(value.c_str(), "%f %f %f", &out[0], &out[1], &out[2]) == 3;
+}
+
+std::vector<BSPEntity> ParseEntities(std::string_view text) {
+    std::vector<BSPEntity> entities;
+    size_t pos = 0;
+
+    while (pos < text.size()) {
+        while (pos < text.size() && text[pos] != '{') ++pos;
+        if (pos >= text.size()) break;
+        ++pos;
+
+        BSPEntity entity;
+        std::string key, value;
+        bool closed = false;
+        while (pos < text.size()) {
+            while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\r' || text[pos] == '\n')) ++pos;
+            if (pos >= text.size()) break;
+            if (text[pos] == '}') {
+                ++pos;
+                closed = true;
+                break;
+            }
+            if (!ReadQuoted(text, pos, key) || !ReadQuoted(text, pos, value)) break;
+            entity.keyValues.emplace_back(std::move(key), std::move(value));
+        }
+
+        if (!closed) break;
+        entities.push_back(std::move(entity));
+    }
+
+    return entities;
+}
+
+} // namespace WorldAPI
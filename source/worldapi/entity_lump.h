@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace WorldAPI {
+
+    // One "{ "key" "value" ... }" block of the entity lump, keys in file order
+    struct BSPEntity {
+        std::vector<std::pair<std::string, std::string>> keyValues;
+
+        // First value of a key (case-insensitive), or fallback
+        std::string_view Get(std::string_view key, std::string_view fallback = {}) const;
+        // Parses a "x y z" style value; returns false if the key is missing or short
+        bool GetVector(std::string_view key, float out[3]) const;
+    };
+
+    // Tokenises the entity lump text. Malformed trailing blocks are dropped.
+    std::vector<BSPEntity> ParseEntities(std::string_view text);
+
+} // namespace WorldAPI
@@ -0,0 +1,71 @@
+#include "game_paths.h"
+
+#include <filesystem>
+#include <system_error>
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+namespace WorldAPI {
+
+namespace {
+
+    std::filesystem::path ExecutablePath() {
+#ifdef _WIN32
+        char exePath[MAX_PATH];
+        DWORD length = GetModuleFileNameA(nullptr, exePath, sizeof(exePath));
+        if (length == 0 || length >= sizeof(exePath)) return {};
+        return std::filesystem::path(exePath);
+#else
+        std::error_code ec;
+        auto path = std::filesystem::read_symlink("/proc/self/exe", ec);
+        return ec ? std::filesystem::path() : path;
+#endif
+    }
+
+    std::string LocateGameDirectory() {
+        std::error_code ec;
+
+        // Expected structure: GameRoot/bin/win64/gmod.exe (or GameRoot/hl2.exe on 32-bit)
+        std::filesystem::path dir = ExecutablePath().parent_path();
+        for (int depth = 0; depth < 4 && !dir.empty(); ++depth) {
+            if (std::filesystem::is_directory(dir / "garrysmod", ec)) {
+                return dir.string();
+            }
+            if (dir == dir.parent_path()) break;
+            dir = dir.parent_path();
+        }
+
+        auto cwd = std::filesystem::current_path(ec);
+        return ec ? std::string() : cwd.string();
+    }
+
+} // namespace
+
+const std::string& FindGameDirectory() {
+    static const std::string gameDirectory = LocateGameDirectory();
+    return gameDirectory;
+}
+
+std::string ResolveGamePath(const std::string& relativePath) {
+    const std::string& root = FindGameDirectory();
+    if (root.empty() || relativePath.empty()) return "";
+
+    std::error_code ec;
+    const std::filesystem::path base = std::filesystem::path(root) / "garrysmod";
+    for (const auto& candidate : { base / relativePath, base / "download" / relativePath }) {
+        if (std::filesystem::is_regular_file(candidate, ec)) {
+            return candidate.string();
+        }
+    }
+    return "";
+}
+
+std::string GetDataPath(const std::string& relativePath) {
+    const std::string& root = FindGameDirectory();
+    if (root.empty()) return "";
+    return (std::filesystem::path(root) / "garrysmod" / "data" / relativePath).string();
+}
+
+} // namespace WorldAPI
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+
+namespace WorldAPI {
+
+    // Absolute path of the game root (the directory holding garrysmod/ and bin/).
+    // Resolved once from the executable location, falling back to the working directory.
+    const std::string& FindGameDirectory();
+
+    // Resolves a GAME-relative path ("maps/gm_flatgrass.bsp") to a file on disk, checking
+    // garrysmod/ and then garrysmod/download/. Returns an empty string when the file only
+    // exists inside a mounted archive (workshop GMA, VPK) and has to be read through Lua.
+    std::string ResolveGamePath(const std::string& relativePath);
+
+    // Absolute path inside the garrysmod/data/ directory; parent directories are not created.
+    std::string GetDataPath(const std::string& relativePath);
+
+} // namespace WorldAPI
@@ -0,0 +1,367 @@
+#include "geometry_cache.h"
+#include "game_paths.h"
+#include "mapped_file.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+namespace WorldAPI {
+
+namespace {
+
+    constexpr uint32_t CACHE_MAGIC = ('C' << 24) + ('G' << 16) + ('W' << 8) + 'R'; // "RWGC"
+    // Bump whenever the record layout or the builders' output changes
+    constexpr uint32_t CACHE_VERSION = 1;
+    constexpr uint32_t CACHE_KIND_WORLD = 1;
+    constexpr uint32_t CACHE_KIND_DISPLACEMENT = 2;
+    constexpr uint32_t GROUP_FLAG_TRANSLUCENT = 1;
+    constexpr const char* CACHE_DIRECTORY = "remixworld";
+
+    constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+    constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+    static_assert(sizeof(MeshVertex) == 32, "MeshVertex is written to the cache as raw bytes");
+
+#pragma pack(push, 1)
+    struct CacheHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t kind;
+        uint32_t groupCount;
+        uint64_t checksum;
+        uint64_t settingsHash;
+        int32_t cellSize;   // chunk or bin size
+        uint32_t reserved;
+        uint64_t itemCount; // faces or displacements
+        uint64_t rejectedCount;
+    };
+
+    // Followed by: material bytes, int32 clusters, uint32 indices, MeshVertex vertices, uint8 alphas
+    struct CacheGroupRecord {
+        int32_t cell[3];
+        uint32_t flags;
+        float mins[3];
+        float maxs[3];
+        uint32_t materialLength;
+        uint32_t clusterCount;
+        uint32_t indexCount;
+        uint32_t vertexCount;
+        uint32_t alphaCount;
+    };
+#pragma pack(pop)
+
+    // Word-at-a-time FNV-1a; only used to detect changed maps, not for security
+    uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, bytes + i, sizeof(word));
+            hash = (hash ^ word) * FNV_PRIME;
+        }
+        for (; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+    uint64_t HashString(uint64_t hash, const std::string& value) {
+        const uint64_t length = value.size();
+        hash = HashBytes(hash, &length, sizeof(length));
+        return HashBytes(hash, value.data(), value.size());
+    }
+
+    // Bounds-checked cursor over the mapped cache file
+    class CacheReader {
+    public:
+        CacheReader(const uint8_t* data, size_t size) : m_data(data), m_size(size), m_offset(0) {}
+
+        template <typename T>
+        bool Read(T& out) {
+            if (m_size - m_offset < sizeof(T)) return false;
+            std::memcpy(&out, m_data + m_offset, sizeof(T));
+            m_offset += sizeof(T);
+            return true;
+        }
+
+        template <typename T>
+        bool ReadArray(std::vector<T>& out, size_t count) {
+            if (count > (m_size - m_offset) / sizeof(T)) return false;
+            out.resize(count);
+            if (count) std::memcpy(out.data(), m_data + m_offset, count * sizeof(T));
+            m_offset += count * sizeof(T);
+            return true;
+        }
+
+        bool ReadString(std::string& out, size_t length) {
+            if (m_size - m_offset < length) return false;
+            out.assign(reinterpret_cast<const char*>(m_data + m_offset), length);
+            m_offset += length;
+            return true;
+        }
+
+        bool AtEnd() const { return m_offset == m_size; }
+
+    private:
+        const uint8_t* m_data;
+        size_t m_size;
+        size_t m_offset;
+    };
+
+    class CacheWriter {
+    public:
+        explicit CacheWriter(const std::string& path) : m_stream(path, std::ios::binary | std::ios::trunc) {}
+
+        bool IsOpen() const { return m_stream.is_open(); }
+        bool Good() const { return m_stream.good(); }
+
+        template <typename T>
+        void Write(const T& value) {
+            m_stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        void WriteArray(const std::vector<T>& values) {
+            if (!values.empty()) m_stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+        }
+
+        void WriteString(const std::string& value) {
+            m_stream.write(value.data(), value.size());
+        }
+
+        void Close() { m_stream.close(); }
+
+    private:
+        std::ofstream m_stream;
+    };
+
+    bool OpenCache(const std::string& path, uint32_t kind, uint64_t checksum, uint64_t settingsHash,
+                   MappedFile& file, CacheHeader& header) {
+        std::error_code ec;
+        if (path.empty() || !std::filesystem::is_regular_file(path, ec)) return false;
+        if (!file.Open(path) || file.Size() < sizeof(CacheHeader)) return false;
+
+        std::memcpy(&header, file.Data(), sizeof(header));
+        return header.magic == CACHE_MAGIC && header.version == CACHE_VERSION && header.kind == kind &&
+               header.checksum == checksum && header.settingsHash == settingsHash;
+    }
+
+    // Writes to <path>.tmp and renames over the old file once everything is flushed
+    template <typename WriteBody>
+    bool WriteCacheFile(const std::string& path, const CacheHeader& header, WriteBody&& writeBody) {
+        if (path.empty()) return false;
+
+        std::error_code ec;
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+
+        const std::string tempPath = path + ".tmp";
+        {
+            CacheWriter writer(tempPath);
+            if (!writer.IsOpen()) return false;
+
+            writer.Write(header);
+            writeBody(writer);
+            writer.Close();
+            if (!writer.Good()) {
+                std::filesystem::remove(tempPath, ec);
+                return false;
+            }
+        }
+
+        std::filesystem::rename(tempPath, path, ec);
+        if (ec) {
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+        return true;
+    }
+
+    CacheHeader MakeHeader(uint32_t kind, uint64_t checksum, uint64_t settingsHash, size_t groupCount,
+                           int cellSize, size_t itemCount, size_t rejectedCount) {
+        CacheHeader header = {};
+        header.magic = CACHE_MAGIC;
+        header.version = CACHE_VERSION;
+        header.kind = kind;
+        header.groupCount = static_cast<uint32_t>(groupCount);
+        header.checksum = checksum;
+        header.settingsHash = settingsHash;
+        header.cellSize = cellSize;
+        header.itemCount = itemCount;
+        header.rejectedCount = rejectedCount;
+        return header;
+    }
+
+} // namespace
+
+uint64_t ComputeMapChecksum(const BSPFile& map) {
+    static const int geometryLumps[] = {
+        LUMP_ENTITIES, LUMP_PLANES, LUMP_TEXDATA, LUMP_VERTEXES, LUMP_VISIBILITY, LUMP_NODES,
+        LUMP_TEXINFO, LUMP_FACES, LUMP_LEAFS, LUMP_EDGES, LUMP_SURFEDGES, LUMP_MODELS,
+        LUMP_LEAFFACES, LUMP_DISPINFO, LUMP_DISP_VERTS, LUMP_TEXDATA_STRING_DATA, LUMP_TEXDATA_STRING_TABLE
+    };
+
+    uint64_t hash = FNV_OFFSET;
+    const int32_t header[2] = { map.GetVersion(), map.GetMapRevision() };
+    hash = HashBytes(hash, header, sizeof(header));
+
+    for (int lump : geometryLumps) {
+        const std::string_view data = map.GetLumpData(lump);
+        const uint64_t info[2] = { data.size(), static_cast<uint64_t>(map.GetLumpVersion(lump)) };
+        hash = HashBytes(hash, info, sizeof(info));
+        hash = HashBytes(hash, data.data(), data.size());
+    }
+    return hash;
+}
+
+uint64_t HashSettings(const WorldBuildSettings& settings) {
+    uint64_t hash = HashBytes(FNV_OFFSET, &CACHE_KIND_WORLD, sizeof(CACHE_KIND_WORLD));
+    hash = HashBytes(hash, &settings.chunkSize, sizeof(settings.chunkSize));
+    hash = HashString(hash, settings.whitelist);
+    return HashString(hash, settings.blacklist);
+}
+
+uint64_t HashSettings(const DisplacementBuildSettings& settings) {
+    uint64_t hash = HashBytes(FNV_OFFSET, &CACHE_KIND_DISPLACEMENT, sizeof(CACHE_KIND_DISPLACEMENT));
+    hash = HashBytes(hash, &settings.binSize, sizeof(settings.binSize));
+    hash = HashString(hash, settings.whitelist);
+    return HashString(hash, settings.blacklist);
+}
+
+std::string GetGeometryCachePath(const BSPFile& map, const char* kind) {
+    const std::string mapName = std::filesystem::path(map.GetPath()).stem().string();
+    if (mapName.empty()) return "";
+    return GetDataPath(std::string(CACHE_DIRECTORY) + "/" + mapName + "_" + kind + ".dat");
+}
+
+bool LoadGeometryCache(const std::string& path, uint64_t checksum, uint64_t settingsHash, WorldBuildResult& out) {
+    MappedFile file;
+    CacheHeader header;
+    if (!OpenCache(path, CACHE_KIND_WORLD, checksum, settingsHash, file, header)) return false;
+
+    CacheReader reader(file.Data() + sizeof(header), file.Size() - sizeof(header));
+    WorldBuildResult result;
+    result.chunkSize = header.cellSize;
+    result.faceCount = static_cast<size_t>(header.itemCount);
+    result.rejectedFaces = static_cast<size_t>(header.rejectedCount);
+    result.groups.resize(header.groupCount);
+
+    for (WorldChunkGroup& group : result.groups) {
+        CacheGroupRecord record;
+        if (!reader.Read(record)) return false;
+
+        std::memcpy(group.chunk, record.cell, sizeof(group.chunk));
+        std::memcpy(group.mins, record.mins, sizeof(group.mins));
+        std::memcpy(group.maxs, record.maxs, sizeof(group.maxs));
+        group.translucent = (record.flags & GROUP_FLAG_TRANSLUCENT) != 0;
+
+        if (!reader.ReadString(group.material, record.materialLength) ||
+            !reader.ReadArray(group.clusters, record.clusterCount) ||
+            !reader.ReadArray(group.faces, record.indexCount) ||
+            !reader.ReadArray(group.vertices, record.vertexCount)) {
+            return false;
+        }
+    }
+    if (!reader.AtEnd()) return false;
+
+    out = std::move(result);
+    return true;
+}
+
+bool LoadGeometryCache(const std::string& path, uint64_t checksum, uint64_t settingsHash, DisplacementBuildResult& out) {
+    MappedFile file;
+    CacheHeader header;
+    if (!OpenCache(path, CACHE_KIND_DISPLACEMENT, checksum, settingsHash, file, header)) return false;
+
+    CacheReader reader(file.Data() + sizeof(header), file.Size() - sizeof(header));
+    DisplacementBuildResult result;
+    result.binSize = header.cellSize;
+    result.displacementCount = static_cast<size_t>(header.itemCount);
+    result.rejectedDisplacements = static_cast<size_t>(header.rejectedCount);
+    result.groups.resize(header.groupCount);
+
+    for (DisplacementGroup& group : result.groups) {
+        CacheGroupRecord record;
+        if (!reader.Read(record)) return false;
+
+        std::memcpy(group.bin, record.cell, sizeof(group.bin));
+        std::memcpy(group.mins, record.mins, sizeof(group.mins));
+        std::memcpy(group.maxs, record.maxs, sizeof(group.maxs));
+
+        if (record.clusterCount != 0 ||
+            !reader.ReadString(group.material, record.materialLength) ||
+            !reader.ReadArray(group.displacements, record.indexCount) ||
+            !reader.ReadArray(group.vertices, record.vertexCount) ||
+            !reader.ReadArray(group.alphas, record.alphaCount)) {
+            return false;
+        }
+    }
+    if (!reader.AtEnd()) return false;
+
+    out = std::move(result);
+    return true;
+}
+
+bool SaveGeometryCache(const std::string& path, uint64_t checksum, uint64_t settingsHash, const WorldBuildResult& result) {
+    const CacheHeader header = MakeHeader(CACHE_KIND_WORLD, checksum, settingsHash, result.groups.size(),
+                                          result.chunkSize, result.faceCount, result.rejectedFaces);
+
+    return WriteCacheFile(path, header, [&](CacheWriter& writer) {
+        for (const WorldChunkGroup& group : result.groups) {
+            CacheGroupRecord record = {};
+            std::memcpy(record.cell, group.chunk, sizeof(record.cell));
+            std::memcpy(record.mins, group.mins, sizeof(record.mins));
+            std::memcpy(record.maxs, group.maxs, sizeof(record.maxs));
+            record.flags = group.translucent ? GROUP_FLAG_TRANSLUCENT : 0;
+            record.materialLength = static_cast<uint32_t>(group.material.size());
+            record.clusterCount = static_cast<uint32_t>(group.clusters.size());
+            record.indexCount = static_cast<uint32_t>(group.faces.size());
+            record.vertexCount = static_cast<uint32_t>(group.vertices.size());
+
+            writer.Write(record);
+            writer.WriteString(group.material);
+            writer.WriteArray(group.clusters);
+            writer.WriteArray(group.faces);
+            writer.WriteArray(group.vertices);
+        }
+    });
+}
+
+bool SaveGeometryCache(const std::string& path, uint64_t checksum, uint64_t settingsHash, const DisplacementBuildResult& result) {
+    const CacheHeader header = MakeHeader(CACHE_KIND_DISPLACEMENT, checksum, settingsHash, result.groups.size(),
+                                          result.binSize, result.displacementCount, result.rejectedDisplacements);
+
+    return WriteCacheFile(path, header, [&](CacheWriter& writer) {
+        for (const DisplacementGroup& group : result.groups) {
+            CacheGroupRecord record = {};
+            std::memcpy(record.cell, group.bin, sizeof(record.cell));
+            std::memcpy(record.mins, group.mins, sizeof(record.mins));
+            std::memcpy(record.maxs, group.maxs, sizeof(record.maxs));
+            record.materialLength = static_cast<uint32_t>(group.material.size());
+            record.indexCount = static_cast<uint32_t>(group.displacements.size());
+            record.vertexCount = static_cast<uint32_t>(group.vertices.size());
+            record.alphaCount = static_cast<uint32_t>(group.alphas.size());
+
+            writer.Write(record);
+            writer.WriteString(group.material);
+            writer.WriteArray(group.displacements);
+            writer.WriteArray(group.vertices);
+            writer.WriteArray(group.alphas);
+        }
+    });
+}
+
+size_t ClearGeometryCache() {
+    const std::string directory = GetDataPath(CACHE_DIRECTORY);
+    if (directory.empty()) return 0;
+
+    std::error_code ec;
+    size_t removed = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+        if (entry.path().extension() == ".dat" && std::filesystem::remove(entry.path(), ec)) ++removed;
+    }
+    return removed;
+}
+
+} // namespace WorldAPI
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "bsp_file.h"
+#include "displacement_builder.h"
+#include "world_builder.h"
+
+#include <cstdint>
+#include <string>
+
+// On-disk cache of built world geometry (garrysmod/data/remixworld/<map>_<kind>.dat).
+// One file per map and geometry kind; the header records the checksum of the BSP's geometry
+// lumps and a hash of the build settings, so a mismatch simply rebuilds and overwrites it.
+namespace WorldAPI {
+
+    // Hash of the header and every lump the native builders read (not the pakfile)
+    uint64_t ComputeMapChecksum(const BSPFile& map);
+
+    uint64_t HashSettings(const WorldBuildSettings& settings);
+    uint64_t HashSettings(const DisplacementBuildSettings& settings);
+
+    // Absolute cache file path for a map ("world", "disp"); empty when the game directory is unknown
+    std::string GetGeometryCachePath(const BSPFile& map, const char* kind);
+
+    // Loads return false on a missing, stale or corrupt file and leave the result untouched
+    bool LoadGeometryCache(const std::string& path, uint64_t checksum, uint64_t settingsHash, WorldBuildResult& out);
+    bool LoadGeometryCache(const std::string& path, uint64_t checksum, uint64_t settingsHash, DisplacementBuildResult& out);
+
+    // Writes through a temporary file and renames it, so readers never see a partial cache
+    bool SaveGeometryCache(const std::string& path, uint64_t checksum, uint64_t settingsHash, const WorldBuildResult& result);
+    bool SaveGeometryCache(const std::string& path, uint64_t checksum, uint64_t settingsHash, const DisplacementBuildResult& result);
+
+    // Deletes every cache file; returns the number removed
+    size_t ClearGeometryCache();
+
+} // namespace WorldAPI
@@ -0,0 +1,777 @@
+#include "worldapi.h"
+#include "geometry_cache.h"
+#include "vertex_kernel.h"
+#include <tier0/dbg.h>
+#include <mathlib/vector.h>
+
+#include <algorithm>
+#include <limits>
+
+using namespace GarrysMod::Lua;
+
+namespace WorldAPI {
+
+// Helper: read a Lua array of { pos = Vector, normal = Vector, u = number, v = number }
+static bool LuaToVertexList(ILuaBase* LUA, int index, std::vector<MeshVertex>& out) {
+    if (!LUA->IsType(index, Type::Table)) return false;
+
+    const int count = LUA->ObjLen(index);
+    out.clear();
+    out.reserve(count);
+
+    for (int i = 1; i <= count; ++i) {
+        LUA->PushNumber(i);
+        LUA->GetTable(index);
+        if (!LUA->IsType(-1, Type::Table)) {
+            LUA->Pop();
+            return false;
+        }
+
+        MeshVertex vertex = {};
+
+        LUA->GetField(-1, "pos");
+        if (LUA->IsType(-1, Type::Vector)) {
+            const Vector& pos = LUA->GetVector(-1);
+            vertex.pos[0] = pos.x; vertex.pos[1] = pos.y; vertex.pos[2] = pos.z;
+        }
+        LUA->Pop();
+
+        LUA->GetField(-1, "normal");
+        if (LUA->IsType(-1, Type::Vector)) {
+            const Vector& normal = LUA->GetVector(-1);
+            vertex.normal[0] = normal.x; vertex.normal[1] = normal.y; vertex.normal[2] = normal.z;
+        }
+        LUA->Pop();
+
+        LUA->GetField(-1, "u");
+        if (LUA->IsType(-1, Type::Number)) vertex.uv[0] = static_cast<float>(LUA->GetNumber(-1));
+        LUA->Pop();
+
+        LUA->GetField(-1, "v");
+        if (LUA->IsType(-1, Type::Number)) vertex.uv[1] = static_cast<float>(LUA->GetNumber(-1));
+        LUA->Pop();
+
+        LUA->Pop(); // vertex table
+        out.push_back(vertex);
+    }
+
+    return true;
+}
+
+// Helper: push a vertex list back as the same table layout
+static void PushVertexList(ILuaBase* LUA, const std::vector<MeshVertex>& vertices) {
+    LUA->CreateTable();
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        const MeshVertex& vertex = vertices[i];
+
+        LUA->PushNumber(static_cast<double>(i + 1));
+        LUA->CreateTable();
+        LUA->PushVector(Vector(vertex.pos[0], vertex.pos[1], vertex.pos[2])); LUA->SetField(-2, "pos");
+        LUA->PushVector(Vector(vertex.normal[0], vertex.normal[1], vertex.normal[2])); LUA->SetField(-2, "normal");
+        LUA->PushNumber(vertex.uv[0]); LUA->SetField(-2, "u");
+        LUA->PushNumber(vertex.uv[1]); LUA->SetField(-2, "v");
+        LUA->SetTable(-3);
+    }
+}
+
+// Lua function: RemixWorld.SimplifyTriangles(vertices, ratio, maxError?, lockBorders?)
+LUA_FUNCTION(RemixWorld_SimplifyTriangles) {
+    if (!LUA->IsType(1, Type::Table)) {
+        LUA->ThrowError("Expected vertex table for SimplifyTriangles");
+        return 0;
+    }
+
+    if (!LUA->IsType(2, Type::Number)) {
+        LUA->ThrowError("Expected number for target ratio");
+        return 0;
+    }
+
+    SimplifyOptions options;
+    options.targetRatio = static_cast<float>(LUA->GetNumber(2));
+    if (LUA->IsType(3, Type::Number)) options.maxError = static_cast<float>(LUA->GetNumber(3));
+    if (LUA->IsType(4, Type::Bool)) options.lockBorders = LUA->GetBool(4);
+
+    bool validVertices = false;
+    {
+        // ThrowError doesn't unwind C++ frames, so the vertex copies are gone before it runs
+        std::vector<MeshVertex> vertices;
+        validVertices = LuaToVertexList(LUA, 1, vertices);
+        if (validVertices) {
+            try {
+                auto& geometryManager = WorldAPI::Instance().GetGeometryManager();
+                PushVertexList(LUA, geometryManager.SimplifyTriangles(vertices, options));
+            } catch (...) {
+                Error("[RemixWorld] Exception in SimplifyTriangles\n");
+                LUA->PushNil();
+            }
+        }
+    }
+    if (!validVertices) {
+        LUA->ThrowError("Expected vertex table for SimplifyTriangles");
+        return 0;
+    }
+    return 1;
+}
+
+// Lua function: RemixWorld.BuildLODChain(vertices, { ratio, ... }, maxError?, lockBorders?)
+// Returns an array of vertex tables, one per level that actually reduced the mesh.
+LUA_FUNCTION(RemixWorld_BuildLODChain) {
+    if (!LUA->IsType(1, Type::Table)) {
+        LUA->ThrowError("Expected vertex table for BuildLODChain");
+        return 0;
+    }
+
+    if (!LUA->IsType(2, Type::Table)) {
+        LUA->ThrowError("Expected table of ratios");
+        return 0;
+    }
+
+    SimplifyOptions options;
+    if (LUA->IsType(3, Type::Number)) options.maxError = static_cast<float>(LUA->GetNumber(3));
+    if (LUA->IsType(4, Type::Bool)) options.lockBorders = LUA->GetBool(4);
+
+    bool validVertices = false;
+    {
+        // As in SimplifyTriangles, nothing here may be live when ThrowError runs
+        std::vector<MeshVertex> vertices;
+        validVertices = LuaToVertexList(LUA, 1, vertices);
+        if (validVertices) {
+            std::vector<float> ratios;
+            const int ratioCount = LUA->ObjLen(2);
+            for (int i = 1; i <= ratioCount; ++i) {
+                LUA->PushNumber(i);
+                LUA->GetTable(2);
+                if (LUA->IsType(-1, Type::Number)) ratios.push_back(static_cast<float>(LUA->GetNumber(-1)));
+                LUA->Pop();
+            }
+
+            try {
+                auto& geometryManager = WorldAPI::Instance().GetGeometryManager();
+                auto levels = geometryManager.BuildLODChain(vertices, ratios, options);
+
+                LUA->CreateTable();
+                for (size_t i = 0; i < levels.size(); ++i) {
+                    LUA->PushNumber(static_cast<double>(i + 1));
+                    PushVertexList(LUA, levels[i]);
+                    LUA->SetTable(-3);
+                }
+            } catch (...) {
+                Error("[RemixWorld] Exception in BuildLODChain\n");
+                LUA->PushNil();
+            }
+        }
+    }
+    if (!validVertices) {
+        LUA->ThrowError("Expected vertex table for BuildLODChain");
+        return 0;
+    }
+    return 1;
+}
+
+// Reads { chunkSize?, whitelist?, blacklist?, cache? } at stack index 1
+static WorldBuildSettings ReadWorldSettings(ILuaBase* LUA) {
+    WorldBuildSettings settings;
+    if (LUA->IsType(1, Type::Table)) {
+        LUA->GetField(1, "chunkSize");
+        if (LUA->IsType(-1, Type::Number)) settings.chunkSize = static_cast<int>(LUA->GetNumber(-1));
+        LUA->Pop();
+
+        LUA->GetField(1, "whitelist");
+        if (LUA->IsType(-1, Type::String)) settings.whitelist = LUA->GetString(-1);
+        LUA->Pop();
+
+        LUA->GetField(1, "blacklist");
+        if (LUA->IsType(-1, Type::String)) settings.blacklist = LUA->GetString(-1);
+        LUA->Pop();
+
+        LUA->GetField(1, "cache");
+        if (LUA->IsType(-1, Type::Bool)) settings.useCache = LUA->GetBool(-1);
+        LUA->Pop();
+
+        LUA->GetField(1, "lods");
+        if (LUA->IsType(-1, Type::Table)) {
+            const int ratioCount = LUA->ObjLen(-1);
+            for (int i = 1; i <= ratioCount; ++i) {
+                LUA->PushNumber(i);
+                LUA->GetTable(-2);
+                if (LUA->IsType(-1, Type::Number)) settings.lodRatios.push_back(static_cast<float>(LUA->GetNumber(-1)));
+                LUA->Pop();
+            }
+        }
+        LUA->Pop();
+
+        LUA->GetField(1, "lodMinVertices");
+        if (LUA->IsType(-1, Type::Number)) settings.lodMinVertices = static_cast<size_t>(std::max(0.0, LUA->GetNumber(-1)));
+        LUA->Pop();
+
+        LUA->GetField(1, "lodMaxError");
+        if (LUA->IsType(-1, Type::Number)) settings.lodOptions.maxError = static_cast<float>(LUA->GetNumber(-1));
+        LUA->Pop();
+    }
+    return settings;
+}
+
+// Pushes the summary table returned by BuildWorldChunks
+static void PushWorldSummary(ILuaBase* LUA, const GeometryManager& geometryManager) {
+    const WorldBuildResult& world = geometryManager.GetWorld();
+    LUA->CreateTable();
+    LUA->PushNumber(world.chunkSize); LUA->SetField(-2, "chunkSize");
+    LUA->PushNumber(static_cast<double>(world.faceCount)); LUA->SetField(-2, "faces");
+    LUA->PushNumber(static_cast<double>(world.rejectedFaces)); LUA->SetField(-2, "rejected");
+
+    LUA->CreateTable();
+    for (size_t i = 0; i < world.groups.size(); ++i) {
+        const WorldChunkGroup& group = world.groups[i];
+        const std::string chunkKey = std::to_string(group.chunk[0]) + "," + std::to_string(group.chunk[1]) + "," + std::to_string(group.chunk[2]);
+
+        LUA->PushNumber(static_cast<double>(i + 1));
+        LUA->CreateTable();
+        LUA->PushString(chunkKey.c_str()); LUA->SetField(-2, "chunk");
+        LUA->PushString(group.material.c_str()); LUA->SetField(-2, "material");
+        LUA->PushBool(group.translucent); LUA->SetField(-2, "translucent");
+        LUA->PushNumber(static_cast<double>(group.vertices.size())); LUA->SetField(-2, "vertexCount");
+        LUA->PushVector(Vector(group.mins[0], group.mins[1], group.mins[2])); LUA->SetField(-2, "mins");
+        LUA->PushVector(Vector(group.maxs[0], group.maxs[1], group.maxs[2])); LUA->SetField(-2, "maxs");
+
+        LUA->CreateTable();
+        for (int32_t cluster : group.clusters) {
+            LUA->PushNumber(cluster);
+            LUA->PushBool(true);
+            LUA->SetTable(-3);
+        }
+        LUA->SetField(-2, "clusters");
+
+        const size_t levels = geometryManager.GetWorldGroupLODCount(i);
+        if (levels > 0) {
+            LUA->CreateTable();
+            for (size_t level = 1; level <= levels; ++level) {
+                LUA->PushNumber(static_cast<double>(level));
+                LUA->PushNumber(static_cast<double>(geometryManager.GetWorldGroupVertices(i, level)->size()));
+                LUA->SetTable(-3);
+            }
+            LUA->SetField(-2, "lods");
+        }
+
+        LUA->SetTable(-3);
+    }
+    LUA->SetField(-2, "groups");
+}
+
+// Lua function: RemixWorld.BuildWorldChunks({ chunkSize?, whitelist?, blacklist?, cache?, lods?, lodMinVertices?, lodMaxError? })
+// Builds chunks for the map opened through RemixBSP. Returns { chunkSize, faces, rejected, groups = {
+// { chunk = "x,y,z", material, translucent, vertexCount, mins, maxs, clusters = { [cluster] = true },
+// lods = { vertexCount, ... }? } } }. lods = { ratio, ... } simplifies every group of at least
+// lodMinVertices vertices into one level per ratio as part of the build; a group's lods entry
+// lists the levels simplification kept.
+LUA_FUNCTION(RemixWorld_BuildWorldChunks) {
+    const WorldBuildSettings settings = ReadWorldSettings(LUA);
+
+    auto& geometryManager = WorldAPI::Instance().GetGeometryManager();
+    std::string error;
+    try {
+        if (!geometryManager.BuildWorld(settings, error)) {
+            LUA->PushNil();
+            LUA->PushString(error.c_str());
+            return 2;
+        }
+    } catch (...) {
+        Error("[RemixWorld] Exception in BuildWorldChunks\n");
+        LUA->PushNil();
+        return 1;
+    }
+
+    PushWorldSummary(LUA, geometryManager);
+    return 1;
+}
+
+// Lua function: RemixWorld.PlanWorldBatches(maxVertices, maxExtent?) -> array of
+// { material, translucent, vertexCount, mins, maxs, clusters = { [cluster] = true }, groups = { groupIndex, ... } }
+// Groups neighbouring chunks' geometry per material into shared meshes; see PlanWorldBatches.
+LUA_FUNCTION(RemixWorld_PlanWorldBatches) {
+    if (!LUA->IsType(1, Type::Number)) {
+        LUA->ThrowError("Expected maximum vertex count");
+        return 0;
+    }
+
+    const size_t maxVertices = static_cast<size_t>(std::max(3.0, LUA->GetNumber(1)));
+    const float maxExtent = LUA->IsType(2, Type::Number) ? static_cast<float>(LUA->GetNumber(2)) : 0.0f;
+    const auto batches = PlanWorldBatches(WorldAPI::Instance().GetGeometryManager().GetWorld(), maxVertices, maxExtent);
+
+    LUA->CreateTable();
+    for (size_t b = 0; b < batches.size(); ++b) {
+        const WorldBatch& batch = batches[b];
+
+        LUA->PushNumber(static_cast<double>(b + 1));
+        LUA->CreateTable();
+        LUA->PushString(batch.material.c_str()); LUA->SetField(-2, "material");
+        LUA->PushBool(batch.translucent); LUA->SetField(-2, "translucent");
+        LUA->PushNumber(static_cast<double>(batch.vertexCount)); LUA->SetField(-2, "vertexCount");
+        LUA->PushVector(Vector(batch.mins[0], batch.mins[1], batch.mins[2])); LUA->SetField(-2, "mins");
+        LUA->PushVector(Vector(batch.maxs[0], batch.maxs[1], batch.maxs[2])); LUA->SetField(-2, "maxs");
+
+        LUA->CreateTable();
+        for (int32_t cluster : batch.clusters) {
+            LUA->PushNumber(cluster);
+            LUA->PushBool(true);
+            LUA->SetTable(-3);
+        }
+        LUA->SetField(-2, "clusters");
+
+        LUA->CreateTable();
+        for (size_t i = 0; i < batch.groups.size(); ++i) {
+            LUA->PushNumber(static_cast<double>(i + 1));
+            LUA->PushNumber(static_cast<double>(batch.groups[i] + 1));
+            LUA->SetTable(-3);
+        }
+        LUA->SetField(-2, "groups");
+
+        LUA->SetTable(-3);
+    }
+    return 1;
+}
+
+// Lua function: RemixWorld.BuildWorldGroupLODs(groupIndex, { ratio, ... }, maxError?) -> { vertexCount, ... }
+// Blocking; world builds started with lods already carry these levels.
+LUA_FUNCTION(RemixWorld_BuildWorldGroupLODs) {
+    if (!LUA->IsType(1, Type::Number) || !LUA->IsType(2, Type::Table)) {
+        LUA->ThrowError("Expected group index and table of ratios");
+        return 0;
+    }
+
+    std::vector<float> ratios;
+    const int ratioCount = LUA->ObjLen(2);
+    for (int i = 1; i <= ratioCount; ++i) {
+        LUA->PushNumber(i);
+        LUA->GetTable(2);
+        if (LUA->IsType(-1, Type::Number)) ratios.push_back(static_cast<float>(LUA->GetNumber(-1)));
+        LUA->Pop();
+    }
+
+    SimplifyOptions options;
+    if (LUA->IsType(3, Type::Number)) options.maxError = static_cast<float>(LUA->GetNumber(3));
+
+    auto& geometryManager = WorldAPI::Instance().GetGeometryManager();
+    const size_t groupIndex = static_cast<size_t>(LUA->GetNumber(1)) - 1;
+    const size_t levels = geometryManager.BuildWorldGroupLODs(groupIndex, ratios, options);
+
+    LUA->CreateTable();
+    for (size_t level = 1; level <= levels; ++level) {
+        const std::vector<MeshVertex>* vertices = geometryManager.GetWorldGroupVertices(groupIndex, level);
+        if (!vertices) break;
+        LUA->PushNumber(static_cast<double>(level));
+        LUA->PushNumber(static_cast<double>(vertices->size()));
+        LUA->SetTable(-3);
+    }
+    return 1;
+}
+
+// Helper: feed vertices [first, first + count) into the active mesh builder through the cached
+// mesh.Position/Normal/TexCoord(/Color)/AdvanceVertex functions. alphas is optional and becomes the
+// vertex colour alpha (displacement blending). Returns the number of vertices emitted.
+static size_t EmitVertices(ILuaBase* LUA, const std::vector<MeshVertex>& vertices, const std::vector<uint8_t>* alphas,
+                           double firstArg, double countArg) {
+    const size_t first = static_cast<size_t>(std::max(1.0, firstArg)) - 1;
+    const size_t count = std::min(static_cast<size_t>(std::max(0.0, countArg)), first < vertices.size() ? vertices.size() - first : 0);
+    if (alphas && alphas->size() < vertices.size()) alphas = nullptr;
+
+    // Cache the mesh library functions on the stack
+    LUA->PushSpecial(GarrysMod::Lua::SPECIAL_GLOB);
+    LUA->GetField(-1, "mesh");
+    if (!LUA->IsType(-1, Type::Table)) {
+        LUA->Pop(2);
+        return 0;
+    }
+    LUA->GetField(-1, "Position");
+    LUA->GetField(-2, "Normal");
+    LUA->GetField(-3, "TexCoord");
+    LUA->GetField(-4, "Color");
+    LUA->GetField(-5, "AdvanceVertex");
+    const int advanceFn = LUA->Top();
+    const int colorFn = advanceFn - 1;
+    const int texCoordFn = advanceFn - 2;
+    const int normalFn = advanceFn - 3;
+    const int positionFn = advanceFn - 4;
+
+    for (size_t i = first; i < first + count; ++i) {
+        const MeshVertex& v = vertices[i];
+
+        LUA->Push(positionFn);
+        LUA->PushVector(Vector(v.pos[0], v.pos[1], v.pos[2]));
+        LUA->Call(1, 0);
+
+        LUA->Push(normalFn);
+        LUA->PushVector(Vector(v.normal[0], v.normal[1], v.normal[2]));
+        LUA->Call(1, 0);
+
+        LUA->Push(texCoordFn);
+        LUA->PushNumber(0);
+        LUA->PushNumber(v.uv[0]);
+        LUA->PushNumber(v.uv[1]);
+        LUA->Call(3, 0);
+
+        if (alphas) {
+            LUA->Push(colorFn);
+            LUA->PushNumber(255);
+            LUA->PushNumber(255);
+            LUA->PushNumber(255);
+            LUA->PushNumber((*alphas)[i]);
+            LUA->Call(4, 0);
+        }
+
+        LUA->Push(advanceFn);
+        LUA->Call(0, 0);
+    }
+
+    LUA->Pop(7); // functions, mesh table, global table
+    return count;
+}
+
+// Lua function: RemixWorld.EmitWorldGroup(groupIndex, firstVertex, vertexCount, level?) -> emitted
+// Must be called between mesh.Begin and mesh.End; feeds the vertices straight into the mesh builder
+// so no per-vertex Lua tables are created.
+LUA_FUNCTION(RemixWorld_EmitWorldGroup) {
+    if (!LUA->IsType(1, Type::Number) || !LUA->IsType(2, Type::Number) || !LUA->IsType(3, Type::Number)) {
+        LUA->ThrowError("Expected group index, first vertex and vertex count");
+        return 0;
+    }
+
+    const size_t groupIndex = static_cast<size_t>(LUA->GetNumber(1)) - 1;
+    const size_t level = LUA->IsType(4, Type::Number) ? static_cast<size_t>(LUA->GetNumber(4)) : 0;
+    const auto* vertices = WorldAPI::Instance().GetGeometryManager().GetWorldGroupVertices(groupIndex, level);
+    if (!vertices) {
+        LUA->PushNumber(0);
+        return 1;
+    }
+
+    LUA->PushNumber(static_cast<double>(EmitVertices(LUA, *vertices, nullptr, LUA->GetNumber(2), LUA->GetNumber(3))));
+    return 1;
+}
+
+// Reads { binSize?, whitelist?, blacklist?, cache? } at stack index 1
+static DisplacementBuildSettings ReadDisplacementSettings(ILuaBase* LUA) {
+    DisplacementBuildSettings settings;
+    if (LUA->IsType(1, Type::Table)) {
+        LUA->GetField(1, "binSize");
+        if (LUA->IsType(-1, Type::Number)) settings.binSize = static_cast<int>(LUA->GetNumber(-1));
+        LUA->Pop();
+
+        LUA->GetField(1, "whitelist");
+        if (LUA->IsType(-1, Type::String)) settings.whitelist = LUA->GetString(-1);
+        LUA->Pop();
+
+        LUA->GetField(1, "blacklist");
+        if (LUA->IsType(-1, Type::String)) settings.blacklist = LUA->GetString(-1);
+        LUA->Pop();
+
+        LUA->GetField(1, "cache");
+        if (LUA->IsType(-1, Type::Bool)) settings.useCache = LUA->GetBool(-1);
+        LUA->Pop();
+    }
+    return settings;
+}
+
+// Pushes the summary table returned by BuildDisplacements
+static void PushDisplacementSummary(ILuaBase* LUA, const DisplacementBuildResult& displacements) {
+    LUA->CreateTable();
+    LUA->PushNumber(displacements.binSize); LUA->SetField(-2, "binSize");
+    LUA->PushNumber(static_cast<double>(displacements.displacementCount)); LUA->SetField(-2, "displacements");
+    LUA->PushNumber(static_cast<double>(displacements.rejectedDisplacements)); LUA->SetField(-2, "rejected");
+
+    LUA->CreateTable();
+    for (size_t i = 0; i < displacements.groups.size(); ++i) {
+        const DisplacementGroup& group = displacements.groups[i];
+        const std::string binKey = std::to_string(group.bin[0]) + "," + std::to_string(group.bin[1]) + "," + std::to_string(group.bin[2]);
+
+        LUA->PushNumber(static_cast<double>(i + 1));
+        LUA->CreateTable();
+        LUA->PushString(binKey.c_str()); LUA->SetField(-2, "bin");
+        LUA->PushString(group.material.c_str()); LUA->SetField(-2, "material");
+        LUA->PushNumber(static_cast<double>(group.vertices.size())); LUA->SetField(-2, "vertexCount");
+        LUA->PushNumber(static_cast<double>(group.displacements.size())); LUA->SetField(-2, "displacements");
+        LUA->PushVector(Vector(group.mins[0], group.mins[1], group.mins[2])); LUA->SetField(-2, "mins");
+        LUA->PushVector(Vector(group.maxs[0], group.maxs[1], group.maxs[2])); LUA->SetField(-2, "maxs");
+        LUA->SetTable(-3);
+    }
+    LUA->SetField(-2, "groups");
+}
+
+// Lua function: RemixWorld.BuildDisplacements({ binSize?, whitelist?, blacklist?, cache? })
+// Tessellates the displacements of the map opened through RemixBSP. Returns { binSize, displacements,
+// rejected, groups = { { bin = "x,y,z", material, vertexCount, displacements, mins, maxs } } }
+LUA_FUNCTION(RemixWorld_BuildDisplacements) {
+    const DisplacementBuildSettings settings = ReadDisplacementSettings(LUA);
+
+    auto& geometryManager = WorldAPI::Instance().GetGeometryManager();
+    std::string error;
+    try {
+        if (!geometryManager.BuildDisplacements(settings, error)) {
+            LUA->PushNil();
+            LUA->PushString(error.c_str());
+            return 2;
+        }
+    } catch (...) {
+        Error("[RemixWorld] Exception in BuildDisplacements\n");
+        LUA->PushNil();
+        return 1;
+    }
+
+    PushDisplacementSummary(LUA, geometryManager.GetDisplacements());
+    return 1;
+}
+
+// Lua function: RemixWorld.StartWorldBuild(settings) -> jobId, error
+// Background version of BuildWorldChunks; poll the job with PollBuild.
+LUA_FUNCTION(RemixWorld_StartWorldBuild) {
+    std::string error;
+    const uint32_t jobId = WorldAPI::Instance().GetGeometryManager().StartWorldBuild(ReadWorldSettings(LUA), error);
+    if (!jobId) {
+        LUA->PushNil();
+        LUA->PushString(error.c_str());
+        return 2;
+    }
+
+    LUA->PushNumber(jobId);
+    return 1;
+}
+
+// Lua function: RemixWorld.StartDisplacementBuild(settings) -> jobId, error
+// Background version of BuildDisplacements; poll the job with PollBuild.
+LUA_FUNCTION(RemixWorld_StartDisplacementBuild) {
+    std::string error;
+    const uint32_t jobId = WorldAPI::Instance().GetGeometryManager().StartDisplacementBuild(ReadDisplacementSettings(LUA), error);
+    if (!jobId) {
+        LUA->PushNil();
+        LUA->PushString(error.c_str());
+        return 2;
+    }
+
+    LUA->PushNumber(jobId);
+    return 1;
+}
+
+// Lua function: RemixWorld.PollBuild(jobId) -> state, progress, summary|error
+// state is "running", "done", "failed" or "cancelled". On "done" the result becomes the current
+// world/displacement set (as if the blocking Build* call had returned) and its summary is returned.
+LUA_FUNCTION(RemixWorld_PollBuild) {
+    if (!LUA->IsType(1, Type::Number)) {
+        LUA->ThrowError("Expected job id");
+        return 0;
+    }
+
+    auto& geometryManager = WorldAPI::Instance().GetGeometryManager();
+    BuildKind kind = BuildKind::World;
+    float progress = 0.0f;
+    std::string error;
+    const BuildState state = geometryManager.PollBuild(static_cast<uint32_t>(LUA->GetNumber(1)), kind, progress, error);
+
+    LUA->PushString(GetBuildStateName(state));
+    LUA->PushNumber(progress);
+    if (state == BuildState::Done) {
+        if (kind == BuildKind::World) {
+            PushWorldSummary(LUA, geometryManager);
+        } else {
+            PushDisplacementSummary(LUA, geometryManager.GetDisplacements());
+        }
+        return 3;
+    }
+    if (state == BuildState::Failed) {
+        LUA->PushString(error.c_str());
+        return 3;
+    }
+    return 2;
+}
+
+// Lua function: RemixWorld.CancelBuild(jobId)
+LUA_FUNCTION(RemixWorld_CancelBuild) {
+    if (!LUA->IsType(1, Type::Number)) {
+        LUA->ThrowError("Expected job id");
+        return 0;
+    }
+
+    WorldAPI::Instance().GetGeometryManager().CancelBuild(static_cast<uint32_t>(LUA->GetNumber(1)));
+    return 0;
+}
+
+// Lua function: RemixWorld.EmitDisplacementGroup(groupIndex, firstVertex, vertexCount) -> emitted
+// Same contract as EmitWorldGroup; also writes mesh.Color with the blend alpha.
+LUA_FUNCTION(RemixWorld_EmitDisplacementGroup) {
+    if (!LUA->IsType(1, Type::Number) || !LUA->IsType(2, Type::Number) || !LUA->IsType(3, Type::Number)) {
+        LUA->ThrowError("Expected group index, first vertex and vertex count");
+        return 0;
+    }
+
+    const auto& groups = WorldAPI::Instance().GetGeometryManager().GetDisplacements().groups;
+    const size_t groupIndex = static_cast<size_t>(LUA->GetNumber(1)) - 1;
+    if (groupIndex >= groups.size()) {
+        LUA->PushNumber(0);
+        return 1;
+    }
+
+    const DisplacementGroup& group = groups[groupIndex];
+    LUA->PushNumber(static_cast<double>(EmitVertices(LUA, group.vertices, &group.alphas, LUA->GetNumber(2), LUA->GetNumber(3))));
+    return 1;
+}
+
+// Lua function: RemixWorld.ReleaseDisplacements()
+LUA_FUNCTION(RemixWorld_ReleaseDisplacements) {
+    WorldAPI::Instance().GetGeometryManager().ReleaseDisplacements();
+    return 0;
+}
+
+// Lua function: RemixWorld.ReleaseWorldChunks()
+LUA_FUNCTION(RemixWorld_ReleaseWorldChunks) {
+    WorldAPI::Instance().GetGeometryManager().ReleaseWorld();
+    return 0;
+}
+
+// Lua function: RemixWorld.ClearGeometryCache() -> removed file count
+LUA_FUNCTION(RemixWorld_ClearGeometryCache) {
+    const size_t removed = ClearGeometryCache();
+    Msg("[GeometryManager] Removed %zu geometry cache files\n", removed);
+    LUA->PushNumber(static_cast<double>(removed));
+    return 1;
+}
+
+// Lua function: RemixWorld.IsMaterialAllowed(name, whitelist, blacklist) -> bool
+// Same rules as RenderCore.IsMaterialAllowed; the lists compile once per distinct string pair
+// and verdicts are cached per material name.
+LUA_FUNCTION(RemixWorld_IsMaterialAllowed) {
+    if (!LUA->IsType(1, Type::String)) {
+        LUA->PushBool(false);
+        return 1;
+    }
+
+    const std::string whitelist = LUA->IsType(2, Type::String) ? LUA->GetString(2) : "";
+    const std::string blacklist = LUA->IsType(3, Type::String) ? LUA->GetString(3) : "";
+    auto& verdicts = WorldAPI::Instance().GetGeometryManager().GetMaterialVerdicts();
+    LUA->PushBool(verdicts.IsAllowed(whitelist, blacklist, LUA->GetString(1)));
+    return 1;
+}
+
+// Lua function: RemixWorld.IsSkyboxMaterial(name) -> bool
+LUA_FUNCTION(RemixWorld_IsSkyboxMaterial) {
+    LUA->PushBool(LUA->IsType(1, Type::String) && IsSkyboxMaterialName(LUA->GetString(1)));
+    return 1;
+}
+
+// Lua function: RemixWorld.ValidateVertices(vertices) -> rejectedCount, mins, maxs, rejected?
+// vertices holds { pos = Vector } tables or bare Vectors; entries without a position count as
+// rejected. mins/maxs cover the accepted vertices (+/-inf if none) and rejected is an
+// { [index] = true } set, only returned when something was rejected.
+LUA_FUNCTION(RemixWorld_ValidateVertices) {
+    if (!LUA->IsType(1, Type::Table)) {
+        LUA->ThrowError("Expected vertex table");
+        return 0;
+    }
+
+    const int count = LUA->ObjLen(1);
+    std::vector<float> positions(static_cast<size_t>(count) * 3, std::numeric_limits<float>::quiet_NaN());
+    for (int i = 1; i <= count; ++i) {
+        LUA->PushNumber(i);
+        LUA->GetTable(1);
+        int pushed = 1;
+        if (LUA->IsType(-1, Type::Table)) {
+            LUA->GetField(-1, "pos");
+            ++pushed;
+        }
+        if (LUA->IsType(-1, Type::Vector)) {
+            const Vector& pos = LUA->GetVector(-1);
+            float* out = &positions[static_cast<size_t>(i - 1) * 3];
+            out[0] = pos.x; out[1] = pos.y; out[2] = pos.z;
+        }
+        LUA->Pop(pushed);
+    }
+
+    VertexBounds bounds;
+    std::vector<uint32_t> mask;
+    const size_t rejected = ValidatePositions(positions.data(), static_cast<size_t>(count), 3, bounds, &mask);
+
+    LUA->PushNumber(static_cast<double>(rejected));
+    LUA->PushVector(Vector(bounds.mins[0], bounds.mins[1], bounds.mins[2]));
+    LUA->PushVector(Vector(bounds.maxs[0], bounds.maxs[1], bounds.maxs[2]));
+    if (rejected == 0) return 3;
+
+    LUA->CreateTable();
+    for (size_t i = 0; i < static_cast<size_t>(count); ++i) {
+        if (!(mask[i / 32] & (1u << (i % 32)))) continue;
+        LUA->PushNumber(static_cast<double>(i + 1));
+        LUA->PushBool(true);
+        LUA->SetTable(-3);
+    }
+    return 4;
+}
+
+// Initialize Geometry Manager Lua bindings
+void GeometryManager::InitializeLuaBindings() {
+    if (!m_lua) return;
+
+    // Get the global table
+    m_lua->PushSpecial(GarrysMod::Lua::SPECIAL_GLOB);
+
+    // Create RemixWorld table
+    m_lua->CreateTable();
+
+    m_lua->PushCFunction(RemixWorld_SimplifyTriangles);
+    m_lua->SetField(-2, "SimplifyTriangles");
+
+    m_lua->PushCFunction(RemixWorld_BuildLODChain);
+    m_lua->SetField(-2, "BuildLODChain");
+
+    m_lua->PushCFunction(RemixWorld_BuildWorldChunks);
+    m_lua->SetField(-2, "BuildWorldChunks");
+
+    m_lua->PushCFunction(RemixWorld_PlanWorldBatches);
+    m_lua->SetField(-2, "PlanWorldBatches");
+
+    m_lua->PushCFunction(RemixWorld_BuildWorldGroupLODs);
+    m_lua->SetField(-2, "BuildWorldGroupLODs");
+
+    m_lua->PushCFunction(RemixWorld_EmitWorldGroup);
+    m_lua->SetField(-2, "EmitWorldGroup");
+
+    m_lua->PushCFunction(RemixWorld_ReleaseWorldChunks);
+    m_lua->SetField(-2, "ReleaseWorldChunks");
+
+    m_lua->PushCFunction(RemixWorld_BuildDisplacements);
+    m_lua->SetField(-2, "BuildDisplacements");
+
+    m_lua->PushCFunction(RemixWorld_EmitDisplacementGroup);
+    m_lua->SetField(-2, "EmitDisplacementGroup");
+
+    m_lua->PushCFunction(RemixWorld_ReleaseDisplacements);
+    m_lua->SetField(-2, "ReleaseDisplacements");
+
+    m_lua->PushCFunction(RemixWorld_StartWorldBuild);
+    m_lua->SetField(-2, "StartWorldBuild");
+
+    m_lua->PushCFunction(RemixWorld_StartDisplacementBuild);
+    m_lua->SetField(-2, "StartDisplacementBuild");
+
+    m_lua->PushCFunction(RemixWorld_PollBuild);
+    m_lua->SetField(-2, "PollBuild");
+
+    m_lua->PushCFunction(RemixWorld_CancelBuild);
+    m_lua->SetField(-2, "CancelBuild");
+
+    m_lua->PushCFunction(RemixWorld_ClearGeometryCache);
+    m_lua->SetField(-2, "ClearGeometryCache");
+
+    m_lua->PushCFunction(RemixWorld_IsMaterialAllowed);
+    m_lua->SetField(-2, "IsMaterialAllowed");
+
+    m_lua->PushCFunction(RemixWorld_IsSkyboxMaterial);
+    m_lua->SetField(-2, "IsSkyboxMaterial");
+
+    m_lua->PushCFunction(RemixWorld_ValidateVertices);
+    m_lua->SetField(-2, "ValidateVertices");
+
+    // Set the table as a global field
+    m_lua->SetField(-2, "RemixWorld");
+
+    // Pop the global table
+    m_lua->Pop();
+
+    Msg("[GeometryManager] Lua bindings initialized\n");
+}
+
+} // namespace WorldAPI
@@ -0,0 +1,228 @@
+#include "map_lights.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+
+namespace WorldAPI {
+
+namespace {
+
+    constexpr float DEG_TO_RAD = 3.14159265358979323846f / 180.0f;
+
+    // First non-empty value among a key and its underscore-prefixed alias
+    std::string_view GetEither(const BSPEntity& entity, std::string_view key, std::string_view alias) {
+        std::string_view value = entity.Get(key);
+        return value.empty() ? entity.Get(alias) : value;
+    }
+
+    // Lua tonumber(): the whole value must be a number, surrounding spaces allowed
+    bool ParseNumber(std::string_view text, float& out) {
+        const std::string value(text);
+        const char* begin = value.c_str();
+        char* end = nullptr;
+        const double number = std::strtod(begin, &end);
+        if (end == begin) return false;
+        while (*end == ' ' || *end == '\t') ++end;
+        if (*end != '\0') return false;
+        out = static_cast<float>(number);
+        return true;
+    }
+
+    float NumberOr(std::string_view text, float fallback) {
+        float value;
+        return ParseNumber(text, value) ? value : fallback;
+    }
+
+    bool ParseTriple(std::string_view text, float out[3]) {
+        const std::string value(text);
+        return !value.empty() && std::sscanf(value.c_str(), "%f %f %f", &out[0], &out[1], &out[2]) == 3;
+    }
+
+    // "angles" as pitch yaw roll, a bare yaw, or separate pitch/angle keys. Source stores
+    // light pitch with positive pointing down, so it is negated here.
+    bool ParseLightAngles(const BSPEntity& entity, float out[3]) {
+        const std::string_view angles = GetEither(entity, "angles", "_angles");
+        const std::string_view pitch = GetEither(entity, "pitch", "_pitch");
+        const std::string_view yaw = GetEither(entity, "angle", "_angle");
+
+        if (!angles.empty()) {
+            float parsed[3];
+            if (ParseTriple(angles, parsed)) {
+                out[0] = -parsed[0]; out[1] = parsed[1]; out[2] = parsed[2];
+                return true;
+            }
+            float yawOnly;
+            if (ParseNumber(angles, yawOnly)) {
+                out[0] = -NumberOr(pitch, 0.0f); out[1] = yawOnly; out[2] = 0.0f;
+                return true;
+            }
+        }
+
+        if (!pitch.empty() || !yaw.empty()) {
+            out[0] = -NumberOr(pitch, 0.0f); out[1] = NumberOr(yaw, 0.0f); out[2] = 0.0f;
+            return true;
+        }
+        return false;
+    }
+
+    // Forward, right and up of pitch/yaw/roll in degrees, as Angle:Forward/Right/Up
+    void AngleVectors(const float angles[3], float forward[3], float right[3], float up[3]) {
+        const float sp = std::sin(angles[0] * DEG_TO_RAD), cp = std::cos(angles[0] * DEG_TO_RAD);
+        const float sy = std::sin(angles[1] * DEG_TO_RAD), cy = std::cos(angles[1] * DEG_TO_RAD);
+        const float sr = std::sin(angles[2] * DEG_TO_RAD), cr = std::cos(angles[2] * DEG_TO_RAD);
+        forward[0] = cp * cy;
+        forward[1] = cp * sy;
+        forward[2] = -sp;
+        right[0] = -sr * sp * cy + cr * sy;
+        right[1] = -sr * sp * sy - cr * cy;
+        right[2] = -sr * cp;
+        up[0] = cr * sp * cy + sr * sy;
+        up[1] = cr * sp * sy - sr * cy;
+        up[2] = cr * cp;
+    }
+
+    // Spot direction from entity angles, offset by the rect rotation and picked by the
+    // rtx_api_map_lights_dir_basis axis, as createRemixLight does for untargeted lights
+    void AngleDirection(const float angles[3], const MapLightSettings& settings, float out[3]) {
+        float rotated[3];
+        for (int axis = 0; axis < 3; ++axis) rotated[axis] = angles[axis] + settings.rotation[axis];
+
+        float forward[3], right[3], up[3];
+        AngleVectors(rotated, forward, right, up);
+
+        const int basis = (settings.directionBasis >= 0 && settings.directionBasis <= 5) ? settings.directionBasis : 0;
+        const float* axisVector = basis < 2 ? forward : (basis < 4 ? up : right);
+        const float sign = (basis % 2) ? -1.0f : 1.0f;
+        for (int axis = 0; axis < 3; ++axis) out[axis] = sign * axisVector[axis];
+    }
+
+    uint32_t Crc32(const char* data, size_t length) {
+        uint32_t crc = 0xFFFFFFFFu;
+        for (size_t i = 0; i < length; ++i) {
+            crc ^= static_cast<uint8_t>(data[i]);
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+            }
+        }
+        return ~crc;
+    }
+
+    // Colour, brightness and size, as getLightProperties computed them
+    void ConvertLight(const BSPEntity& entity, const MapLightSettings& settings, MapLight& light) {
+        int r, g, b, intensity;
+        const std::string lightValue(entity.Get("_light"));
+        if (std::sscanf(lightValue.c_str(), "%d %d %d %d", &r, &g, &b, &intensity) == 4) {
+            light.color[0] = static_cast<uint8_t>(std::clamp(r, 0, 255));
+            light.color[1] = static_cast<uint8_t>(std::clamp(g, 0, 255));
+            light.color[2] = static_cast<uint8_t>(std::clamp(b, 0, 255));
+
+            const float colorIntensity = (r + g + b) / (3.0f * 255.0f);
+            light.brightness = intensity * colorIntensity / 2.55f;
+        }
+        light.brightness *= settings.brightness;
+
+        const float distance = NumberOr(GetEither(entity, "distance", "_distance"), 200.0f);
+        light.size = distance * (1.0f + light.brightness / 200.0f) * settings.sizeMultiplier;
+        light.size = std::min(std::max(light.size, settings.minSize), settings.maxSize);
+
+        if (light.classname == "light_environment") {
+            light.brightness *= 1.5f;
+            light.size *= 1.5f;
+        } else if (light.classname == "light_spot") {
+            light.coneAngle = NumberOr(GetEither(entity, "cone", "_cone"), 45.0f);
+        }
+    }
+
+} // namespace
+
+std::vector<MapLight> ExtractMapLights(const std::vector<BSPEntity>& entities, const MapLightSettings& settings) {
+    std::vector<MapLight> lights;
+
+    // targetname -> origin, for aiming spotlights at their target
+    std::unordered_map<std::string, std::array<float, 3>> targets;
+    for (const BSPEntity& entity : entities) {
+        const std::string_view name = GetEither(entity, "targetname", "_targetname");
+        if (name.empty()) continue;
+        std::array<float, 3> origin = { 0, 0, 0 };
+        entity.GetVector("origin", origin.data());
+        targets[std::string(name)] = origin;
+    }
+
+    // Fixed seed: the same map always jitters (and so hashes) its lights the same way
+    std::minstd_rand jitterRng(0x4C494748u);
+    std::uniform_real_distribution<float> jitter(-settings.jitter, settings.jitter);
+
+    std::unordered_map<std::string, size_t> byPosition;
+    for (const BSPEntity& entity : entities) {
+        const std::string_view classname = entity.Get("classname");
+        const bool supported = classname == "light" || classname == "light_spot" || classname == "light_dynamic" ||
+            (settings.environment && classname == "light_environment");
+        if (!supported) continue;
+
+        MapLight light;
+        light.classname = std::string(classname);
+        if (!entity.GetVector("origin", light.position) && !entity.Get("origin").empty()) continue;
+
+        ConvertLight(entity, settings, light);
+
+        if (light.classname == "light_spot") {
+            float aimAngles[3];
+            if (!GetEither(entity, "angles", "_angles").empty()) {
+                // Raw angles (not negated) orient the debug visual prop
+                light.hasAngles = true;
+                if (!ParseTriple(GetEither(entity, "angles", "_angles"), light.angles)) std::fill(light.angles, light.angles + 3, 0.0f);
+            } else if (!GetEither(entity, "pitch", "_pitch").empty()) {
+                light.hasAngles = true;
+                light.angles[0] = NumberOr(GetEither(entity, "pitch", "_pitch"), 0.0f);
+                light.angles[1] = NumberOr(GetEither(entity, "angle", "_angle"), 0.0f);
+                light.angles[2] = 0.0f;
+            }
+
+            const std::string_view target = GetEither(entity, "target", "_target");
+            auto it = target.empty() ? targets.end() : targets.find(std::string(target));
+            float length = 0.0f;
+            if (it != targets.end()) {
+                for (int axis = 0; axis < 3; ++axis) light.direction[axis] = it->second[axis] - light.position[axis];
+                length = std::sqrt(light.direction[0] * light.direction[0] + light.direction[1] * light.direction[1] +
+                    light.direction[2] * light.direction[2]);
+            }
+
+            if (length > 0.0f) {
+                for (float& d : light.direction) d /= length;
+                light.shaped = true;
+            } else if (ParseLightAngles(entity, aimAngles)) {
+                std::copy(aimAngles, aimAngles + 3, light.angles);
+                light.hasAngles = true;
+                AngleDirection(light.angles, settings, light.direction);
+                light.shaped = true;
+            } else {
+                light.direction[0] = 0.0f; light.direction[1] = 0.0f; light.direction[2] = -1.0f;
+            }
+        }
+
+        if (settings.jitter > 0.0f) {
+            for (float& p : light.position) p += jitter(jitterRng);
+        }
+
+        char key[96];
+        const int keyLength = std::snprintf(key, sizeof(key), "maplight_%.1f_%.1f_%.1f",
+            light.position[0], light.position[1], light.position[2]);
+        light.hash = Crc32(key, static_cast<size_t>(std::max(keyLength, 0)));
+
+        auto [slot, inserted] = byPosition.emplace(std::string(key, static_cast<size_t>(std::max(keyLength, 0))), lights.size());
+        if (inserted) {
+            lights.push_back(std::move(light));
+        } else {
+            lights[slot->second] = std::move(light);
+        }
+    }
+
+    return lights;
+}
+
+} // namespace WorldAPI
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "entity_lump.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace WorldAPI {
+
+    // Mirrors the rtx_api_map_lights_* convars
+    struct MapLightSettings {
+        float brightness = 5.0f;      // multiplier on the 0-100 brightness derived from _light
+        float sizeMultiplier = 5.0f;
+        float minSize = 100.0f;
+        float maxSize = 1000.0f;
+        float jitter = 0.0f;          // max per-axis position offset, 0 to disable
+        bool environment = false;     // also convert light_environment
+        float rotation[3] = { 0, 0, 0 }; // rect_rotation_x/y/z, added to untargeted spot angles
+        int directionBasis = 0;       // dir_basis: 0=F, 1=-F, 2=U, 3=-U, 4=R, 5=-R
+    };
+
+    // One map light converted to Remix sphere parameters
+    struct MapLight {
+        std::string classname;
+        float position[3] = { 0, 0, 0 };
+        uint8_t color[3] = { 255, 255, 255 };
+        float brightness = 100.0f;    // after the multiplier; radiance is color * brightness / 100
+        float size = 200.0f;
+
+        // Spotlight shaping, aimed at the target entity or along the entity angles
+        bool shaped = false;
+        float direction[3] = { 0, 0, -1 };
+        float coneAngle = 45.0f;
+        float coneSoftness = 0.2f;
+        bool hasAngles = false;
+        float angles[3] = { 0, 0, 0 };
+
+        // CRC32 of "maplight_<x>_<y>_<z>", the same light hash the Lua converter used
+        uint32_t hash = 0;
+    };
+
+    // Converts light, light_spot, light_dynamic (and light_environment if enabled) entities.
+    // Lights that land on the same 0.1-unit position collapse into the last one.
+    std::vector<MapLight> ExtractMapLights(const std::vector<BSPEntity>& entities, const MapLightSettings& settings);
+
+} // namespace WorldAPI
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace WorldAPI {
+
+    // Read-only view of a whole file. Uses a memory mapping when the file is on disk,
+    // or owns a copy of the bytes when the data came from Lua (files inside GMAs/VPKs).
+    class MappedFile {
+    public:
+        MappedFile();
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool Open(const std::string& path);
+        void AdoptBuffer(std::string&& buffer);
+        void Close();
+
+        bool IsOpen() const { return m_data != nullptr; }
+        bool IsMapped() const { return m_mapped; }
+        const uint8_t* Data() const { return m_data; }
+        size_t Size() const { return m_size; }
+
+    private:
+#ifdef _WIN32
+        void* m_fileHandle;
+        void* m_mappingHandle;
+#endif
+        const uint8_t* m_data;
+        size_t m_size;
+        bool m_mapped;
+        std::string m_buffer;
+    };
+
+} // namespace WorldAPI
@@ -0,0 +1,178 @@
+#include "material_filter.h"
+
+#include <algorithm>
+#include <iterator>
+#include <queue>
+
+namespace WorldAPI {
+
+namespace {
+
+    constexpr uint32_t TAG_BLACKLIST = 1u << 0;
+    constexpr uint32_t TAG_WHITELIST = 1u << 1;
+
+    // Lists come from three renderers' cvars; anything past this is stale strings piling up
+    constexpr size_t MAX_CACHED_FILTERS = 16;
+
+    inline uint8_t LowerByte(uint8_t c) {
+        return (c >= 'A' && c <= 'Z') ? static_cast<uint8_t>(c - 'A' + 'a') : c;
+    }
+
+} // namespace
+
+std::string ToLowerASCII(std::string_view value) {
+    std::string lower(value);
+    for (char& c : lower) {
+        if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+    }
+    return lower;
+}
+
+void SubstringMatcher::Add(std::string_view pattern, uint32_t tag) {
+    if (pattern.empty()) return;
+    m_patterns.emplace_back(ToLowerASCII(pattern), tag);
+}
+
+void SubstringMatcher::Compile() {
+    // Symbol classes: one per distinct pattern byte, shared by both cases of a letter, so
+    // matching never lowercases the text and the table stays narrow
+    std::fill(std::begin(m_classOf), std::end(m_classOf), uint8_t(0));
+    m_classCount = 1;
+    for (const auto& pattern : m_patterns) {
+        for (char ch : pattern.first) {
+            const uint8_t c = static_cast<uint8_t>(ch);
+            if (m_classOf[c] == 0 && m_classCount < 256) m_classOf[c] = static_cast<uint8_t>(m_classCount++);
+        }
+    }
+    for (int c = 'A'; c <= 'Z'; ++c) {
+        m_classOf[c] = m_classOf[LowerByte(static_cast<uint8_t>(c))];
+    }
+
+    // Trie
+    m_next.assign(m_classCount, -1);
+    m_tags.assign(1, 0);
+    for (const auto& pattern : m_patterns) {
+        int32_t node = 0;
+        for (char ch : pattern.first) {
+            int32_t& next = m_next[node * m_classCount + m_classOf[static_cast<uint8_t>(ch)]];
+            if (next < 0) {
+                next = static_cast<int32_t>(m_tags.size());
+                m_tags.push_back(0);
+                m_next.resize(m_next.size() + m_classCount, -1);
+            }
+            node = m_next[node * m_classCount + m_classOf[static_cast<uint8_t>(ch)]];
+        }
+        m_tags[node] |= pattern.second;
+    }
+
+    // Failure links, folded into a complete transition table (breadth first so every
+    // failure target is finished before the nodes that fall back to it)
+    std::vector<int32_t> fail(m_tags.size(), 0);
+    std::queue<int32_t> pending;
+    for (uint32_t c = 0; c < m_classCount; ++c) {
+        int32_t& next = m_next[c];
+        if (next < 0) {
+            next = 0;
+        } else {
+            pending.push(next);
+        }
+    }
+    while (!pending.empty()) {
+        const int32_t node = pending.front();
+        pending.pop();
+        m_tags[node] |= m_tags[fail[node]];
+
+        for (uint32_t c = 0; c < m_classCount; ++c) {
+            int32_t& next = m_next[node * m_classCount + c];
+            const int32_t fallback = m_next[fail[node] * m_classCount + c];
+            if (next < 0) {
+                next = fallback;
+            } else {
+                fail[next] = fallback;
+                pending.push(next);
+            }
+        }
+    }
+}
+
+uint32_t SubstringMatcher::Match(std::string_view text, uint32_t stopTags) const {
+    if (m_tags.empty()) return 0;
+
+    uint32_t found = 0;
+    int32_t node = 0;
+    for (char ch : text) {
+        node = m_next[node * m_classCount + m_classOf[static_cast<uint8_t>(ch)]];
+        found |= m_tags[node];
+        if (found & stopTags) break;
+    }
+    return found;
+}
+
+MaterialFilter::MaterialFilter(const std::string& whitelist, const std::string& blacklist) {
+    for (const auto& token : BuildMatcherList(blacklist)) m_matcher.Add(token, TAG_BLACKLIST);
+    for (const auto& token : BuildMatcherList(whitelist)) {
+        m_matcher.Add(token, TAG_WHITELIST);
+        m_hasWhitelist = true;
+    }
+    m_matcher.Compile();
+}
+
+std::vector<std::string> MaterialFilter::BuildMatcherList(const std::string& list) {
+    std::vector<std::string> tokens;
+    size_t start = 0;
+    while (start <= list.size()) {
+        size_t end = list.find(',', start);
+        if (end == std::string::npos) end = list.size();
+
+        std::string token = ToLowerASCII(std::string_view(list).substr(start, end - start));
+        token.erase(0, token.find_first_not_of(" \t\r\n"));
+        token.erase(token.find_last_not_of(" \t\r\n") + 1);
+        if (!token.empty()) tokens.push_back(std::move(token));
+
+        start = end + 1;
+    }
+    return tokens;
+}
+
+bool MaterialFilter::IsAllowed(std::string_view materialName) const {
+    if (m_matcher.Empty()) return true;
+
+    const uint32_t found = m_matcher.Match(materialName, TAG_BLACKLIST);
+    if (found & TAG_BLACKLIST) return false;
+    return !m_hasWhitelist || (found & TAG_WHITELIST);
+}
+
+bool MaterialVerdictCache::IsAllowed(const std::string& whitelist, const std::string& blacklist, std::string_view materialName) {
+    std::string key;
+    key.reserve(whitelist.size() + blacklist.size() + 1);
+    key.append(whitelist).append(1, '\n').append(blacklist);
+
+    auto it = m_filters.find(key);
+    if (it == m_filters.end()) {
+        if (m_filters.size() >= MAX_CACHED_FILTERS) m_filters.clear();
+        it = m_filters.emplace(std::move(key), Entry { MaterialFilter(whitelist, blacklist), {} }).first;
+    }
+
+    Entry& entry = it->second;
+    std::string name(materialName);
+    auto verdict = entry.verdicts.find(name);
+    if (verdict != entry.verdicts.end()) return verdict->second;
+
+    const bool allowed = entry.filter.IsAllowed(materialName);
+    entry.verdicts.emplace(std::move(name), allowed);
+    return allowed;
+}
+
+bool IsSkyboxMaterialName(std::string_view materialName) {
+    static const SubstringMatcher matcher = [] {
+        SubstringMatcher skybox;
+        skybox.Add("tools/toolsskybox", 1);
+        skybox.Add("skybox/", 1);
+        skybox.Add("sky_", 1);
+        skybox.Compile();
+        return skybox;
+    }();
+    return matcher.Match(materialName, 1) != 0;
+}
+
+} // namespace WorldAPI
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace WorldAPI {
+
+    // Aho-Corasick automaton over case-insensitive ASCII patterns. Each pattern carries a tag
+    // bit; one pass over a name reports the tags of every pattern it contains.
+    class SubstringMatcher {
+    public:
+        void Add(std::string_view pattern, uint32_t tag);
+        // Builds the transition table; must be called after the last Add
+        void Compile();
+
+        bool Empty() const { return m_patterns.empty(); }
+
+        // OR of the tags found in text. Returns early once any bit of stopTags is found.
+        uint32_t Match(std::string_view text, uint32_t stopTags = 0) const;
+
+    private:
+        std::vector<std::pair<std::string, uint32_t>> m_patterns;
+
+        uint8_t m_classOf[256] = {};        // byte -> symbol class, 0 for bytes in no pattern
+        uint32_t m_classCount = 1;
+        std::vector<int32_t> m_next;        // node * m_classCount + class -> node
+        std::vector<uint32_t> m_tags;       // tags of every pattern ending at (or suffixing) a node
+    };
+
+    // Native counterpart of RemixRenderCore.IsMaterialAllowed: comma-separated,
+    // case-insensitive substring lists. The blacklist wins; an empty whitelist allows all.
+    // Both lists compile into one automaton, so a name is scanned once.
+    class MaterialFilter {
+    public:
+        MaterialFilter() = default;
+        MaterialFilter(const std::string& whitelist, const std::string& blacklist);
+
+        bool IsAllowed(std::string_view materialName) const;
+
+    private:
+        static std::vector<std::string> BuildMatcherList(const std::string& list);
+
+        SubstringMatcher m_matcher;
+        bool m_hasWhitelist = false;
+    };
+
+    // Game-thread verdict cache behind RemixWorld.IsMaterialAllowed: one compiled filter per
+    // whitelist/blacklist pair, each remembering its verdict per material name. A changed cvar
+    // string simply selects (or compiles) another filter.
+    class MaterialVerdictCache {
+    public:
+        bool IsAllowed(const std::string& whitelist, const std::string& blacklist, std::string_view materialName);
+        void Clear() { m_filters.clear(); }
+
+    private:
+        struct Entry {
+            MaterialFilter filter;
+            std::unordered_map<std::string, bool> verdicts;
+        };
+        std::unordered_map<std::string, Entry> m_filters; // whitelist + '\n' + blacklist
+    };
+
+    // tools/toolsskybox, skybox/ and sky_ materials, which the world renderers never draw
+    bool IsSkyboxMaterialName(std::string_view materialName);
+
+    std::string ToLowerASCII(std::string_view value);
+
+} // namespace WorldAPI
@@ -0,0 +1,472 @@
+#include "mesh_simplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <unordered_map>
+
+namespace WorldAPI {
+
+namespace {
+
+    struct WeldKey {
+        int32_t p[3];
+        int32_t n[3];
+        int32_t t[2];
+
+        bool operator==(const WeldKey& o) const {
+            return p[0] == o.p[0] && p[1] == o.p[1] && p[2] == o.p[2] &&
+                   n[0] == o.n[0] && n[1] == o.n[1] && n[2] == o.n[2] &&
+                   t[0] == o.t[0] && t[1] == o.t[1];
+        }
+    };
+
+    struct WeldKeyHash {
+        size_t operator()(const WeldKey& k) const {
+            uint64_t h = 1469598103934665603ull;
+            const int32_t* words = k.p;
+            for (int i = 0; i < 8; ++i) {
+                h ^= static_cast<uint32_t>(words[i]);
+                h *= 1099511628211ull;
+            }
+            return static_cast<size_t>(h);
+        }
+    };
+
+    struct PositionKey {
+        int32_t p[3];
+        bool operator==(const PositionKey& o) const { return p[0] == o.p[0] && p[1] == o.p[1] && p[2] == o.p[2]; }
+    };
+
+    struct PositionKeyHash {
+        size_t operator()(const PositionKey& k) const {
+            return static_cast<size_t>((static_cast<uint64_t>(static_cast<uint32_t>(k.p[0])) * 73856093ull) ^
+                                       (static_cast<uint64_t>(static_cast<uint32_t>(k.p[1])) * 19349663ull) ^
+                                       (static_cast<uint64_t>(static_cast<uint32_t>(k.p[2])) * 83492791ull));
+        }
+    };
+
+    inline int32_t Quantize(float value, float step) {
+        return static_cast<int32_t>(std::floor(value / step + 0.5f));
+    }
+
+    // Symmetric 4x4 error quadric stored as its 10 unique coefficients
+    struct Quadric {
+        double a2 = 0, ab = 0, ac = 0, ad = 0;
+        double b2 = 0, bc = 0, bd = 0;
+        double c2 = 0, cd = 0;
+        double d2 = 0;
+
+        static Quadric FromPlane(double a, double b, double c, double d, double weight) {
+            Quadric q;
+            q.a2 = a * a * weight; q.ab = a * b * weight; q.ac = a * c * weight; q.ad = a * d * weight;
+            q.b2 = b * b * weight; q.bc = b * c * weight; q.bd = b * d * weight;
+            q.c2 = c * c * weight; q.cd = c * d * weight;
+            q.d2 = d * d * weight;
+            return q;
+        }
+
+        void Add(const Quadric& o) {
+            a2 += o.a2; ab += o.ab; ac += o.ac; ad += o.ad;
+            b2 += o.b2; bc += o.bc; bd += o.bd;
+            c2 += o.c2; cd += o.cd;
+            d2 += o.d2;
+        }
+
+        double Evaluate(const float* p) const {
+            const double x = p[0], y = p[1], z = p[2];
+            return a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x +
+                   b2 * y * y + 2 * bc * y * z + 2 * bd * y +
+                   c2 * z * z + 2 * cd * z +
+                   d2;
+        }
+    };
+
+    enum class VertexKind : uint8_t {
+        Manifold, // interior vertex, may collapse onto any neighbour
+        Border,   // open boundary, may only slide along boundary edges
+        Locked    // UV/normal seam or locked border, never moves
+    };
+
+    struct Collapse {
+        double cost;
+        uint32_t from;
+        uint32_t to;
+        uint32_t fromVersion;
+        uint32_t toVersion;
+
+        bool operator>(const Collapse& o) const { return cost > o.cost; }
+    };
+
+    inline void Sub(const float* a, const float* b, double* out) {
+        out[0] = static_cast<double>(a[0]) - b[0];
+        out[1] = static_cast<double>(a[1]) - b[1];
+        out[2] = static_cast<double>(a[2]) - b[2];
+    }
+
+    inline void Cross(const double* a, const double* b, double* out) {
+        out[0] = a[1] * b[2] - a[2] * b[1];
+        out[1] = a[2] * b[0] - a[0] * b[2];
+        out[2] = a[0] * b[1] - a[1] * b[0];
+    }
+
+    inline double Dot(const double* a, const double* b) {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    inline void TriangleNormal(const float* p0, const float* p1, const float* p2, double* out) {
+        double e0[3], e1[3];
+        Sub(p1, p0, e0);
+        Sub(p2, p0, e1);
+        Cross(e0, e1, out);
+    }
+
+    class Simplifier {
+    public:
+        Simplifier(const IndexedMesh& mesh, const SimplifyOptions& options)
+            : m_mesh(mesh)
+            , m_options(options) {
+        }
+
+        IndexedMesh Run();
+
+    private:
+        bool TriangleAlive(uint32_t t) const { return !m_triRemoved[t]; }
+        bool TriangleHas(uint32_t t, uint32_t v) const {
+            return m_tris[t * 3] == v || m_tris[t * 3 + 1] == v || m_tris[t * 3 + 2] == v;
+        }
+
+        uint32_t EdgeTriangleCount(uint32_t a, uint32_t b) const;
+        bool CanCollapse(uint32_t from, uint32_t to) const;
+        bool CollapseFlipsTriangles(uint32_t from, uint32_t to) const;
+        void PushCollapses(uint32_t v);
+        void ApplyCollapse(uint32_t from, uint32_t to);
+
+        const IndexedMesh& m_mesh;
+        SimplifyOptions m_options;
+
+        std::vector<uint32_t> m_tris;
+        std::vector<bool> m_triRemoved;
+        std::vector<std::vector<uint32_t>> m_vertexTris;
+        std::vector<VertexKind> m_kind;
+        std::vector<Quadric> m_quadrics;
+        std::vector<uint32_t> m_version;
+        std::vector<bool> m_vertexRemoved;
+        std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> m_heap;
+        size_t m_liveTris = 0;
+    };
+
+    uint32_t Simplifier::EdgeTriangleCount(uint32_t a, uint32_t b) const {
+        uint32_t count = 0;
+        for (uint32_t t : m_vertexTris[a]) {
+            if (TriangleAlive(t) && TriangleHas(t, b)) ++count;
+        }
+        return count;
+    }
+
+    bool Simplifier::CanCollapse(uint32_t from, uint32_t to) const {
+        if (m_vertexRemoved[from] || m_vertexRemoved[to]) return false;
+        switch (m_kind[from]) {
+            case VertexKind::Manifold:
+                return true;
+            case VertexKind::Border:
+                // Slide only along an open edge so the outline is preserved
+                return m_kind[to] != VertexKind::Manifold && EdgeTriangleCount(from, to) == 1;
+            default:
+                return false;
+        }
+    }
+
+    bool Simplifier::CollapseFlipsTriangles(uint32_t from, uint32_t to) const {
+        const float* target = m_mesh.vertices[to].pos;
+        for (uint32_t t : m_vertexTris[from]) {
+            if (!TriangleAlive(t) || TriangleHas(t, to)) continue;
+
+            const float* p[3];
+            const float* q[3];
+            for (int i = 0; i < 3; ++i) {
+                uint32_t v = m_tris[t * 3 + i];
+                p[i] = m_mesh.vertices[v].pos;
+                q[i] = (v == from) ? target : p[i];
+            }
+
+            double before[3], after[3];
+            TriangleNormal(p[0], p[1], p[2], before);
+            TriangleNormal(q[0], q[1], q[2], after);
+
+            const double lenBefore = std::sqrt(Dot(before, before));
+            const double lenAfter = std::sqrt(Dot(after, after));
+            if (lenAfter <= lenBefore * 1e-4) return true; // degenerates into a sliver
+            if (lenBefore > 0.0 && Dot(before, after) < 0.2 * lenBefore * lenAfter) return true;
+        }
+        return false;
+    }
+
+    void Simplifier::PushCollapses(uint32_t v) {
+        for (uint32_t t : m_vertexTris[v]) {
+            if (!TriangleAlive(t)) continue;
+            for (int i = 0; i < 3; ++i) {
+                uint32_t w = m_tris[t * 3 + i];
+                if (w == v) continue;
+
+                Quadric q = m_quadrics[v];
+                q.Add(m_quadrics[w]);
+
+                if (CanCollapse(v, w)) {
+                    m_heap.push({ q.Evaluate(m_mesh.vertices[w].pos), v, w, m_version[v], m_version[w] });
+                }
+                if (CanCollapse(w, v)) {
+                    m_heap.push({ q.Evaluate(m_mesh.vertices[v].pos), w, v, m_version[w], m_version[v] });
+                }
+            }
+        }
+    }
+
+    void Simplifier::ApplyCollapse(uint32_t from, uint32_t to) {
+        for (uint32_t t : m_vertexTris[from]) {
+            if (!TriangleAlive(t)) continue;
+
+            if (TriangleHas(t, to)) {
+                // Triangle spans the collapsed edge and vanishes
+                m_triRemoved[t] = true;
+                --m_liveTris;
+                continue;
+            }
+
+            for (int i = 0; i < 3; ++i) {
+                if (m_tris[t * 3 + i] == from) m_tris[t * 3 + i] = to;
+            }
+            m_vertexTris[to].push_back(t);
+        }
+
+        m_vertexTris[from].clear();
+        m_vertexRemoved[from] = true;
+        m_quadrics[to].Add(m_quadrics[from]);
+
+        // Drop dead triangle references so adjacency walks stay short
+        auto& adj = m_vertexTris[to];
+        adj.erase(std::remove_if(adj.begin(), adj.end(), [this](uint32_t t) { return !TriangleAlive(t); }), adj.end());
+        std::sort(adj.begin(), adj.end());
+        adj.erase(std::unique(adj.begin(), adj.end()), adj.end());
+
+        // Only 'to' gained a quadric and new neighbours, so only the edges touching it changed
+        // cost; the neighbours' other queued edges stay valid
+        ++m_version[to];
+        PushCollapses(to);
+    }
+
+    IndexedMesh Simplifier::Run() {
+        const size_t vertexCount = m_mesh.vertices.size();
+        const size_t triCount = m_mesh.indices.size() / 3;
+
+        m_tris.assign(m_mesh.indices.begin(), m_mesh.indices.begin() + triCount * 3);
+        m_triRemoved.assign(triCount, false);
+        m_vertexTris.assign(vertexCount, {});
+        m_kind.assign(vertexCount, VertexKind::Manifold);
+        m_quadrics.assign(vertexCount, Quadric());
+        m_version.assign(vertexCount, 0);
+        m_vertexRemoved.assign(vertexCount, false);
+        m_liveTris = triCount;
+
+        for (uint32_t t = 0; t < triCount; ++t) {
+            for (int i = 0; i < 3; ++i) m_vertexTris[m_tris[t * 3 + i]].push_back(t);
+        }
+
+        // Several attribute vertices sharing one position form a seam; moving one would tear the surface
+        {
+            std::unordered_map<PositionKey, uint32_t, PositionKeyHash> positionUse;
+            positionUse.reserve(vertexCount);
+            const float step = std::max(m_options.weldEpsilon, 1e-4f);
+            std::vector<PositionKey> keys(vertexCount);
+            for (size_t v = 0; v < vertexCount; ++v) {
+                if (m_vertexTris[v].empty()) continue;
+                const float* p = m_mesh.vertices[v].pos;
+                keys[v] = { { Quantize(p[0], step), Quantize(p[1], step), Quantize(p[2], step) } };
+                ++positionUse[keys[v]];
+            }
+            for (size_t v = 0; v < vertexCount; ++v) {
+                if (!m_vertexTris[v].empty() && positionUse[keys[v]] > 1) m_kind[v] = VertexKind::Locked;
+            }
+        }
+
+        // Plane quadrics, area weighted
+        for (uint32_t t = 0; t < triCount; ++t) {
+            const float* p0 = m_mesh.vertices[m_tris[t * 3]].pos;
+            const float* p1 = m_mesh.vertices[m_tris[t * 3 + 1]].pos;
+            const float* p2 = m_mesh.vertices[m_tris[t * 3 + 2]].pos;
+
+            double n[3];
+            TriangleNormal(p0, p1, p2, n);
+            const double len = std::sqrt(Dot(n, n));
+            if (len <= 0.0) continue;
+            n[0] /= len; n[1] /= len; n[2] /= len;
+            const double d = -(n[0] * p0[0] + n[1] * p0[1] + n[2] * p0[2]);
+            const Quadric q = Quadric::FromPlane(n[0], n[1], n[2], d, len * 0.5);
+            for (int i = 0; i < 3; ++i) m_quadrics[m_tris[t * 3 + i]].Add(q);
+        }
+
+        // Open edges: either lock their vertices or pin them with perpendicular constraint planes
+        for (uint32_t t = 0; t < triCount; ++t) {
+            for (int i = 0; i < 3; ++i) {
+                const uint32_t a = m_tris[t * 3 + i];
+                const uint32_t b = m_tris[t * 3 + (i + 1) % 3];
+                if (EdgeTriangleCount(a, b) != 1) continue;
+
+                if (m_options.lockBorders) {
+                    m_kind[a] = VertexKind::Locked;
+                    m_kind[b] = VertexKind::Locked;
+                    continue;
+                }
+
+                for (const uint32_t v : { a, b }) {
+                    if (m_kind[v] != VertexKind::Manifold) continue;
+                    const bool onSeam = m_options.seams && m_options.seams->Contains(m_mesh.vertices[v].pos);
+                    m_kind[v] = onSeam ? VertexKind::Locked : VertexKind::Border;
+                }
+
+                const float* pa = m_mesh.vertices[a].pos;
+                const float* pb = m_mesh.vertices[b].pos;
+                const float* pc = m_mesh.vertices[m_tris[t * 3 + (i + 2) % 3]].pos;
+                double edge[3], faceNormal[3], planeNormal[3];
+                Sub(pb, pa, edge);
+                TriangleNormal(pa, pb, pc, faceNormal);
+                Cross(edge, faceNormal, planeNormal);
+                const double len = std::sqrt(Dot(planeNormal, planeNormal));
+                if (len <= 0.0) continue;
+                planeNormal[0] /= len; planeNormal[1] /= len; planeNormal[2] /= len;
+                const double d = -(planeNormal[0] * pa[0] + planeNormal[1] * pa[1] + planeNormal[2] * pa[2]);
+                const Quadric q = Quadric::FromPlane(planeNormal[0], planeNormal[1], planeNormal[2], d, Dot(edge, edge) * 10.0);
+                m_quadrics[a].Add(q);
+                m_quadrics[b].Add(q);
+            }
+        }
+
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            if (!m_vertexTris[v].empty()) PushCollapses(v);
+        }
+
+        const float ratio = std::min(std::max(m_options.targetRatio, 0.0f), 1.0f);
+        const size_t targetTris = std::max<size_t>(1, static_cast<size_t>(triCount * ratio));
+
+        while (m_liveTris > targetTris && !m_heap.empty()) {
+            const Collapse c = m_heap.top();
+            m_heap.pop();
+
+            if (c.fromVersion != m_version[c.from] || c.toVersion != m_version[c.to]) continue;
+            if (c.cost > m_options.maxError) break;
+            if (!CanCollapse(c.from, c.to)) continue;
+            if (CollapseFlipsTriangles(c.from, c.to)) continue;
+
+            ApplyCollapse(c.from, c.to);
+        }
+
+        // Compact surviving triangles and vertices
+        IndexedMesh out;
+        std::vector<uint32_t> remap(vertexCount, UINT32_MAX);
+        out.indices.reserve(m_liveTris * 3);
+        for (uint32_t t = 0; t < triCount; ++t) {
+            if (!TriangleAlive(t)) continue;
+            for (int i = 0; i < 3; ++i) {
+                const uint32_t v = m_tris[t * 3 + i];
+                if (remap[v] == UINT32_MAX) {
+                    remap[v] = static_cast<uint32_t>(out.vertices.size());
+                    out.vertices.push_back(m_mesh.vertices[v]);
+                }
+                out.indices.push_back(remap[v]);
+            }
+        }
+        return out;
+    }
+
+} // namespace
+
+SeamPositions::SeamPositions(float epsilon)
+    : m_step(std::max(epsilon, 1e-4f)) {
+}
+
+size_t SeamPositions::KeyHash::operator()(const Key& k) const {
+    return PositionKeyHash()({ { k.p[0], k.p[1], k.p[2] } });
+}
+
+SeamPositions::Key SeamPositions::MakeKey(const float pos[3]) const {
+    return { { Quantize(pos[0], m_step), Quantize(pos[1], m_step), Quantize(pos[2], m_step) } };
+}
+
+void SeamPositions::Add(const float pos[3]) {
+    m_keys.insert(MakeKey(pos));
+}
+
+bool SeamPositions::Contains(const float pos[3]) const {
+    return m_keys.count(MakeKey(pos)) != 0;
+}
+
+IndexedMesh WeldTriangleSoup(const std::vector<MeshVertex>& soup, float epsilon) {
+    IndexedMesh mesh;
+    const size_t count = soup.size() - soup.size() % 3;
+    mesh.indices.reserve(count);
+    mesh.vertices.reserve(count / 2);
+
+    const float posStep = std::max(epsilon, 1e-4f);
+    std::unordered_map<WeldKey, uint32_t, WeldKeyHash> lookup;
+    lookup.reserve(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        const MeshVertex& v = soup[i];
+        WeldKey key = {
+            { Quantize(v.pos[0], posStep), Quantize(v.pos[1], posStep), Quantize(v.pos[2], posStep) },
+            { Quantize(v.normal[0], 1.0f / 1024.0f), Quantize(v.normal[1], 1.0f / 1024.0f), Quantize(v.normal[2], 1.0f / 1024.0f) },
+            { Quantize(v.uv[0], 1.0f / 4096.0f), Quantize(v.uv[1], 1.0f / 4096.0f) }
+        };
+
+        auto it = lookup.find(key);
+        if (it == lookup.end()) {
+            const uint32_t index = static_cast<uint32_t>(mesh.vertices.size());
+            mesh.vertices.push_back(v);
+            lookup.emplace(key, index);
+            mesh.indices.push_back(index);
+        } else {
+            mesh.indices.push_back(it->second);
+        }
+    }
+
+    return mesh;
+}
+
+std::vector<MeshVertex> UnweldMesh(const IndexedMesh& mesh) {
+    std::vector<MeshVertex> soup;
+    soup.reserve(mesh.indices.size());
+    for (uint32_t index : mesh.indices) soup.push_back(mesh.vertices[index]);
+    return soup;
+}
+
+IndexedMesh SimplifyMesh(const IndexedMesh& mesh, const SimplifyOptions& options) {
+    if (mesh.indices.size() < 3 || mesh.vertices.empty()) return mesh;
+    Simplifier simplifier(mesh, options);
+    return simplifier.Run();
+}
+
+std::vector<IndexedMesh> BuildLODChain(const IndexedMesh& base, const std::vector<float>& ratios, const SimplifyOptions& options) {
+    std::vector<IndexedMesh> chain;
+    const size_t baseTris = base.TriangleCount();
+    if (baseTris == 0) return chain;
+
+    const IndexedMesh* previous = &base;
+    for (float ratio : ratios) {
+        const size_t previousTris = previous->TriangleCount();
+        const size_t targetTris = static_cast<size_t>(baseTris * ratio);
+        if (targetTris == 0 || targetTris >= previousTris) break;
+
+        SimplifyOptions levelOptions = options;
+        levelOptions.targetRatio = static_cast<float>(targetTris) / static_cast<float>(previousTris);
+        IndexedMesh level = SimplifyMesh(*previous, levelOptions);
+
+        // Not worth another BLAS if the level barely shrank
+        if (level.TriangleCount() == 0 || level.TriangleCount() * 10 > previousTris * 9) break;
+
+        chain.push_back(std::move(level));
+        previous = &chain.back();
+    }
+    return chain;
+}
+
+} // namespace WorldAPI
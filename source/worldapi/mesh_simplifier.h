@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace WorldAPI {
+
+    // Vertex layout shared by all native geometry passes (matches the tables
+    // produced by NikNaks' GenerateVertexTriangleData: pos, normal, u, v)
+    struct MeshVertex {
+        float pos[3];
+        float normal[3];
+        float uv[2];
+    };
+
+    struct IndexedMesh {
+        std::vector<MeshVertex> vertices;
+        std::vector<uint32_t> indices;
+
+        size_t TriangleCount() const { return indices.size() / 3; }
+    };
+
+    // Positions (quantized to a weld step) a mesh shares with its neighbours, e.g. where one
+    // world chunk group meets the next
+    class SeamPositions {
+    public:
+        explicit SeamPositions(float epsilon = 0.01f);
+
+        void Add(const float pos[3]);
+        bool Contains(const float pos[3]) const;
+        size_t Size() const { return m_keys.size(); }
+
+    private:
+        struct Key {
+            int32_t p[3];
+            bool operator==(const Key& o) const { return p[0] == o.p[0] && p[1] == o.p[1] && p[2] == o.p[2]; }
+        };
+        struct KeyHash {
+            size_t operator()(const Key& k) const;
+        };
+
+        Key MakeKey(const float pos[3]) const;
+
+        float m_step;
+        std::unordered_set<Key, KeyHash> m_keys;
+    };
+
+    struct SimplifyOptions {
+        // Fraction of the source triangles to keep (0..1)
+        float targetRatio = 0.5f;
+        // Stop collapsing once the quadric error (world units squared) exceeds this
+        float maxError = 64.0f;
+        // Keep every open boundary vertex in place. Off by default: boundary vertices slide
+        // along their boundary instead, and only those listed in seams stay put.
+        bool lockBorders = false;
+        // Open boundary vertices at these positions never move, so the mesh keeps meeting its
+        // neighbours without cracks (optional, not owned)
+        const SeamPositions* seams = nullptr;
+        // Vertices closer than this (and with matching attributes) are welded before simplifying
+        float weldEpsilon = 0.01f;
+    };
+
+    // Welds a non-indexed triangle list (3 vertices per triangle) into an indexed mesh.
+    // Vertices are only merged when position, normal and UV all match within epsilon.
+    IndexedMesh WeldTriangleSoup(const std::vector<MeshVertex>& soup, float epsilon);
+
+    // Expands an indexed mesh back into a triangle list for IMesh building.
+    std::vector<MeshVertex> UnweldMesh(const IndexedMesh& mesh);
+
+    // Quadric error metric simplification (Garland & Heckbert) using half-edge collapses.
+    // Vertices are never moved to new positions, so UVs and normals stay valid; UV seams
+    // are locked, and open borders per options.lockBorders / options.seams.
+    IndexedMesh SimplifyMesh(const IndexedMesh& mesh, const SimplifyOptions& options);
+
+    // Builds successive LOD levels. Each level is simplified from the previous one so the
+    // chain is monotonic; levels that fail to reduce further are omitted.
+    std::vector<IndexedMesh> BuildLODChain(const IndexedMesh& base, const std::vector<float>& ratios, const SimplifyOptions& options);
+
+} // namespace WorldAPI
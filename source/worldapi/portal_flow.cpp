@@ -0,0 +1,368 @@
+#include "portal_flow.h"
+#include "spatial_index.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <queue>
+
+namespace WorldAPI {
+
+namespace {
+
+    // Portal projections per flow before giving up and leaving the frame to the PVS
+    constexpr size_t MAX_FLOW_STEPS = 65536;
+    // Rectangles grow in steps of 1 / RECT_GRID (in units of depth), bounding the passes
+    constexpr float RECT_GRID = 16.0f;
+
+    constexpr int MAX_WINDING_POINTS = 64;
+    constexpr float ON_EPSILON = 0.1f;
+    // A view this close to a portal's plane looks along it, so the portal cannot narrow the view
+    constexpr float EYE_ON_PORTAL = 1.0f;
+    // Windings are clipped to this depth before projecting; ON_EPSILON keeps them in front
+    constexpr float NEAR_DEPTH = 1.0f;
+
+    struct Winding {
+        int count = 0;
+        float points[MAX_WINDING_POINTS][3];
+    };
+
+    inline float Dot(const float a[3], const float b[3]) {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    // Keeps the part of in that lies in front of (or on) the plane. Returns false when nothing
+    // is left. A result that would overflow the point budget keeps the unclipped winding,
+    // which only makes the flow more conservative.
+    bool ClipWinding(const Winding& in, const float plane[4], Winding& out) {
+        float dists[MAX_WINDING_POINTS];
+        bool front = false, back = false;
+        for (int i = 0; i < in.count; ++i) {
+            dists[i] = Dot(in.points[i], plane) - plane[3];
+            if (dists[i] > ON_EPSILON) front = true;
+            else if (dists[i] < -ON_EPSILON) back = true;
+        }
+        if (!front) return false;
+        if (!back) {
+            out = in;
+            return true;
+        }
+
+        out.count = 0;
+        for (int i = 0; i < in.count; ++i) {
+            const int j = (i + 1) % in.count;
+            if (out.count + 2 > MAX_WINDING_POINTS) {
+                out = in;
+                return true;
+            }
+
+            if (dists[i] >= -ON_EPSILON) {
+                float* p = out.points[out.count++];
+                p[0] = in.points[i][0]; p[1] = in.points[i][1]; p[2] = in.points[i][2];
+            }
+            if ((dists[i] > ON_EPSILON && dists[j] < -ON_EPSILON) || (dists[i] < -ON_EPSILON && dists[j] > ON_EPSILON)) {
+                const float t = dists[i] / (dists[i] - dists[j]);
+                float* p = out.points[out.count++];
+                for (int axis = 0; axis < 3; ++axis) {
+                    p[axis] = in.points[i][axis] + (in.points[j][axis] - in.points[i][axis]) * t;
+                }
+            }
+        }
+        return out.count >= 3;
+    }
+
+    // Screen rectangle in units of depth: x = right / forward, y = up / forward
+    struct ViewRect {
+        float x0 = 1.0f, y0 = 1.0f, x1 = -1.0f, y1 = -1.0f;  // empty
+
+        bool IsEmpty() const { return x0 > x1 || y0 > y1; }
+        float Area() const { return IsEmpty() ? 0.0f : (x1 - x0) * (y1 - y0); }
+        bool Contains(const ViewRect& o) const {
+            return o.x0 >= x0 && o.y0 >= y0 && o.x1 <= x1 && o.y1 <= y1;
+        }
+    };
+
+    struct FlowEntry {
+        float area;
+        int32_t cluster;
+        uint32_t version;
+
+        bool operator<(const FlowEntry& o) const { return area < o.area; }
+    };
+
+    struct ViewBasis {
+        float eye[3];
+        float forward[3], right[3], up[3];
+    };
+
+    // Keeps the part of a 2D polygon where a * x + b * y + c >= 0
+    int ClipPolygon2D(const float (*in)[2], int count, float a, float b, float c, float (*out)[2]) {
+        int written = 0;
+        for (int i = 0; i < count; ++i) {
+            const int j = (i + 1) % count;
+            const float di = a * in[i][0] + b * in[i][1] + c;
+            const float dj = a * in[j][0] + b * in[j][1] + c;
+            if (di >= 0.0f) {
+                out[written][0] = in[i][0]; out[written][1] = in[i][1];
+                ++written;
+            }
+            if ((di >= 0.0f) != (dj >= 0.0f)) {
+                const float t = di / (di - dj);
+                out[written][0] = in[i][0] + (in[j][0] - in[i][0]) * t;
+                out[written][1] = in[i][1] + (in[j][1] - in[i][1]) * t;
+                ++written;
+            }
+        }
+        return written;
+    }
+
+    // Bounds of the winding's projection inside clip; empty when they do not overlap
+    ViewRect ProjectWinding(const float* points, uint32_t count, const ViewBasis& view, const ViewRect& clip) {
+        Winding winding, front;
+        winding.count = static_cast<int>(count);
+        for (uint32_t p = 0; p < count; ++p) {
+            winding.points[p][0] = points[p * 3]; winding.points[p][1] = points[p * 3 + 1]; winding.points[p][2] = points[p * 3 + 2];
+        }
+
+        const float nearPlane[4] = { view.forward[0], view.forward[1], view.forward[2], Dot(view.forward, view.eye) + NEAR_DEPTH };
+        if (!ClipWinding(winding, nearPlane, front)) return ViewRect();
+
+        // Each edge of a clipped polygon can add at most one point per clip
+        float polygon[2][MAX_WINDING_POINTS + 8][2];
+        int n = front.count;
+        for (int p = 0; p < n; ++p) {
+            const float d[3] = { front.points[p][0] - view.eye[0], front.points[p][1] - view.eye[1], front.points[p][2] - view.eye[2] };
+            const float depth = Dot(d, view.forward);
+            polygon[0][p][0] = Dot(d, view.right) / depth;
+            polygon[0][p][1] = Dot(d, view.up) / depth;
+        }
+
+        n = ClipPolygon2D(polygon[0], n, 1.0f, 0.0f, -clip.x0, polygon[1]);
+        if (n >= 3) n = ClipPolygon2D(polygon[1], n, -1.0f, 0.0f, clip.x1, polygon[0]);
+        if (n >= 3) n = ClipPolygon2D(polygon[0], n, 0.0f, 1.0f, -clip.y0, polygon[1]);
+        if (n >= 3) n = ClipPolygon2D(polygon[1], n, 0.0f, -1.0f, clip.y1, polygon[0]);
+        if (n < 3) return ViewRect();
+
+        ViewRect bounds = { polygon[0][0][0], polygon[0][0][1], polygon[0][0][0], polygon[0][0][1] };
+        for (int p = 1; p < n; ++p) {
+            bounds.x0 = std::min(bounds.x0, polygon[0][p][0]); bounds.x1 = std::max(bounds.x1, polygon[0][p][0]);
+            bounds.y0 = std::min(bounds.y0, polygon[0][p][1]); bounds.y1 = std::max(bounds.y1, polygon[0][p][1]);
+        }
+        return bounds;
+    }
+
+    // Cursor over the portal file text; parentheses around points count as whitespace
+    class PortalTokenizer {
+    public:
+        explicit PortalTokenizer(const std::string& text) : m_cursor(text.c_str()) {}
+
+        bool Word(std::string& out) {
+            Skip();
+            out.clear();
+            while (*m_cursor && !std::isspace(static_cast<unsigned char>(*m_cursor))) out.push_back(*m_cursor++);
+            return !out.empty();
+        }
+
+        bool Int(long& out) {
+            Skip();
+            char* end = nullptr;
+            out = std::strtol(m_cursor, &end, 10);
+            if (end == m_cursor) return false;
+            m_cursor = end;
+            return true;
+        }
+
+        bool Float(float& out) {
+            Skip();
+            char* end = nullptr;
+            out = std::strtof(m_cursor, &end);
+            if (end == m_cursor) return false;
+            m_cursor = end;
+            return true;
+        }
+
+    private:
+        void Skip() {
+            while (*m_cursor && (std::isspace(static_cast<unsigned char>(*m_cursor)) || *m_cursor == '(' || *m_cursor == ')')) {
+                ++m_cursor;
+            }
+        }
+
+        const char* m_cursor;
+    };
+
+} // namespace
+
+void PortalGraph::Clear() {
+    m_clusterCount = 0;
+    m_portals.clear();
+    m_points.clear();
+    m_clusterStart.clear();
+    m_clusterPortals.clear();
+}
+
+bool PortalGraph::Load(std::string_view text, std::string& error) {
+    Clear();
+
+    const std::string buffer(text);
+    PortalTokenizer tokens(buffer);
+
+    std::string magic;
+    long clusterCount = 0, portalCount = 0;
+    if (!tokens.Word(magic) || magic != "PRT1") {
+        error = "not a PRT1 portal file";
+        return false;
+    }
+    if (!tokens.Int(clusterCount) || !tokens.Int(portalCount) || clusterCount <= 0 || portalCount < 0) {
+        error = "bad portal file header";
+        return false;
+    }
+
+    std::vector<Portal> portals;
+    std::vector<float> points;
+    portals.reserve(static_cast<size_t>(portalCount));
+    for (long i = 0; i < portalCount; ++i) {
+        long pointCount = 0, front = 0, back = 0;
+        if (!tokens.Int(pointCount) || !tokens.Int(front) || !tokens.Int(back)) {
+            error = "truncated portal " + std::to_string(i);
+            return false;
+        }
+        if (pointCount < 3 || pointCount > MAX_WINDING_POINTS ||
+            front < 0 || front >= clusterCount || back < 0 || back >= clusterCount) {
+            error = "bad portal " + std::to_string(i);
+            return false;
+        }
+
+        Portal portal;
+        portal.firstPoint = static_cast<uint32_t>(points.size() / 3);
+        portal.pointCount = static_cast<uint32_t>(pointCount);
+        portal.clusters[0] = static_cast<int32_t>(front);
+        portal.clusters[1] = static_cast<int32_t>(back);
+        for (long p = 0; p < pointCount * 3; ++p) {
+            float value;
+            if (!tokens.Float(value)) {
+                error = "truncated portal " + std::to_string(i);
+                return false;
+            }
+            points.push_back(value);
+        }
+
+        // Newell normal, robust for the slightly non-planar windings vbsp writes
+        const float* winding = &points[static_cast<size_t>(portal.firstPoint) * 3];
+        float normal[3] = { 0, 0, 0 }, center[3] = { 0, 0, 0 };
+        for (long p = 0; p < pointCount; ++p) {
+            const float* a = winding + p * 3;
+            const float* b = winding + ((p + 1) % pointCount) * 3;
+            normal[0] += (a[1] - b[1]) * (a[2] + b[2]);
+            normal[1] += (a[2] - b[2]) * (a[0] + b[0]);
+            normal[2] += (a[0] - b[0]) * (a[1] + b[1]);
+            for (int axis = 0; axis < 3; ++axis) center[axis] += a[axis] / static_cast<float>(pointCount);
+        }
+        const float length = std::sqrt(Dot(normal, normal));
+        if (length > 0.0f) {
+            for (int axis = 0; axis < 3; ++axis) portal.plane[axis] = normal[axis] / length;
+        }
+        portal.plane[3] = Dot(portal.plane, center);
+
+        portals.push_back(portal);
+    }
+
+    // Adjacency as one flat list: portals of cluster c are m_clusterPortals[start[c], start[c + 1])
+    m_clusterStart.assign(static_cast<size_t>(clusterCount) + 1, 0);
+    for (const Portal& portal : portals) {
+        ++m_clusterStart[portal.clusters[0] + 1];
+        if (portal.clusters[1] != portal.clusters[0]) ++m_clusterStart[portal.clusters[1] + 1];
+    }
+    for (size_t c = 1; c < m_clusterStart.size(); ++c) m_clusterStart[c] += m_clusterStart[c - 1];
+
+    m_clusterPortals.resize(m_clusterStart.back());
+    std::vector<uint32_t> fill(m_clusterStart.begin(), m_clusterStart.end() - 1);
+    for (size_t i = 0; i < portals.size(); ++i) {
+        m_clusterPortals[fill[portals[i].clusters[0]]++] = static_cast<uint32_t>(i);
+        if (portals[i].clusters[1] != portals[i].clusters[0]) m_clusterPortals[fill[portals[i].clusters[1]]++] = static_cast<uint32_t>(i);
+    }
+
+    m_clusterCount = static_cast<size_t>(clusterCount);
+    m_portals = std::move(portals);
+    m_points = std::move(points);
+    return true;
+}
+
+bool PortalGraph::FlowVisible(const Frustum& view, int viewCluster, const uint64_t* pvsRow, std::vector<uint64_t>& outRow) const {
+    outRow.assign((m_clusterCount + 63) / 64, 0);
+    if (viewCluster < 0 || static_cast<size_t>(viewCluster) >= m_clusterCount) return false;
+
+    // Left/right and top/bottom planes are symmetric about the view axes (Frustum::FromView)
+    ViewBasis basis;
+    for (int axis = 0; axis < 3; ++axis) {
+        basis.eye[axis] = view.origin[axis];
+        basis.forward[axis] = view.planes[0][axis] + view.planes[1][axis];
+        basis.right[axis] = view.planes[0][axis] - view.planes[1][axis];
+        basis.up[axis] = view.planes[3][axis] - view.planes[2][axis];
+    }
+    for (float* axis : { basis.forward, basis.right, basis.up }) {
+        const float length = std::sqrt(Dot(axis, axis));
+        if (length <= 0.0f) return false;
+        for (int i = 0; i < 3; ++i) axis[i] /= length;
+    }
+
+    // A side plane keeps x >= -tan(half fov), so its slope gives the frustum rectangle
+    const float tanX = Dot(view.planes[0], basis.forward) / std::max(Dot(view.planes[0], basis.right), 1e-6f);
+    const float tanY = Dot(view.planes[3], basis.forward) / std::max(Dot(view.planes[3], basis.up), 1e-6f);
+
+    // Widest rectangles first: their neighbours then tend to reach their final size in one go
+    // instead of growing (and being revisited) once per narrower path
+    std::vector<ViewRect> rects(m_clusterCount);
+    std::vector<uint32_t> versions(m_clusterCount, 0);
+    std::priority_queue<FlowEntry> queue;
+    rects[viewCluster] = { -tanX, -tanY, tanX, tanY };
+    queue.push({ rects[viewCluster].Area(), viewCluster, 0 });
+
+    size_t steps = 0;
+    while (!queue.empty()) {
+        const FlowEntry entry = queue.top();
+        queue.pop();
+        if (entry.version != versions[entry.cluster]) continue; // grown again since queued
+
+        const int32_t cluster = entry.cluster;
+        const ViewRect rect = rects[cluster];
+        for (uint32_t k = m_clusterStart[cluster]; k < m_clusterStart[cluster + 1]; ++k) {
+            if (++steps > MAX_FLOW_STEPS) return false;
+
+            const Portal& portal = m_portals[m_clusterPortals[k]];
+            const int32_t next = portal.clusters[0] == cluster ? portal.clusters[1] : portal.clusters[0];
+            if (pvsRow && !(pvsRow[next / 64] & (1ull << (next % 64)))) continue;
+
+            ViewRect seen = rect;
+            if (std::fabs(Dot(basis.eye, portal.plane) - portal.plane[3]) >= EYE_ON_PORTAL) {
+                seen = ProjectWinding(&m_points[static_cast<size_t>(portal.firstPoint) * 3], portal.pointCount, basis, rect);
+                if (seen.IsEmpty()) continue;
+
+                // Snap outwards so a rectangle grows a bounded number of times
+                seen.x0 = std::floor(seen.x0 * RECT_GRID) / RECT_GRID;
+                seen.y0 = std::floor(seen.y0 * RECT_GRID) / RECT_GRID;
+                seen.x1 = std::ceil(seen.x1 * RECT_GRID) / RECT_GRID;
+                seen.y1 = std::ceil(seen.y1 * RECT_GRID) / RECT_GRID;
+            }
+
+            ViewRect& target = rects[next];
+            if (!target.IsEmpty()) {
+                if (target.Contains(seen)) continue;
+                seen = {
+                    std::min(target.x0, seen.x0), std::min(target.y0, seen.y0),
+                    std::max(target.x1, seen.x1), std::max(target.y1, seen.y1)
+                };
+            }
+            target = seen;
+            queue.push({ target.Area(), next, ++versions[next] });
+        }
+    }
+
+    for (size_t c = 0; c < m_clusterCount; ++c) {
+        if (!rects[c].IsEmpty()) outRow[c / 64] |= 1ull << (c % 64);
+    }
+    return true;
+}
+
+} // namespace WorldAPI
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace WorldAPI {
+
+    struct Frustum;
+
+    // Cluster/portal graph of a vbsp portal file (.prt, "PRT1"). vbsp writes one node per
+    // visibility cluster, so node indices line up with the map's PVS rows.
+    class PortalGraph {
+    public:
+        bool Load(std::string_view text, std::string& error);
+        void Clear();
+
+        bool IsLoaded() const { return m_clusterCount > 0; }
+        size_t GetClusterCount() const { return m_clusterCount; }
+        size_t GetPortalCount() const { return m_portals.size(); }
+
+        // Portal flow from the view: every cluster carries the screen rectangle it can be seen
+        // through, starting with the whole frustum at the view cluster. A portal passes on the
+        // part of its projection inside its cluster's rectangle, and rectangles only grow, so
+        // the flow settles after a bounded number of passes. Any sight line through a chain of
+        // portals stays inside every rectangle along it, which keeps the result conservative.
+        // The flow never leaves pvsRow (the view cluster's PVS row, if given), which prunes it
+        // to what vvis already proved reachable.
+        // Writes a row in ClusterVisibility layout (bit c of word c / 64). Returns false for a
+        // view cluster outside the graph or when the flow exceeded its budget; the row is
+        // unusable then and callers fall back to the PVS.
+        bool FlowVisible(const Frustum& view, int viewCluster, const uint64_t* pvsRow, std::vector<uint64_t>& outRow) const;
+
+    private:
+        struct Portal {
+            uint32_t firstPoint = 0;
+            uint32_t pointCount = 0;
+            int32_t clusters[2] = { -1, -1 };
+            float plane[4] = { 0, 0, 0, 0 };  // normal, distance of the winding
+        };
+
+        size_t m_clusterCount = 0;
+        std::vector<Portal> m_portals;
+        std::vector<float> m_points;           // xyz per winding point
+        std::vector<uint32_t> m_clusterStart;  // m_clusterPortals range per cluster (count + 1)
+        std::vector<uint32_t> m_clusterPortals;
+    };
+
+} // namespace WorldAPI
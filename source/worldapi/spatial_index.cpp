@@ -0,0 +1,276 @@
+#include "spatial_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace WorldAPI {
+
+namespace {
+
+    constexpr uint32_t MAX_LEAF_ITEMS = BoxSoA::KERNEL_WIDTH;
+    constexpr int SAH_BINS = 12;
+    constexpr float DEG_TO_RAD = 3.14159265358979323846f / 180.0f;
+
+    inline float SurfaceArea(const float mins[3], const float maxs[3]) {
+        const float dx = maxs[0] - mins[0], dy = maxs[1] - mins[1], dz = maxs[2] - mins[2];
+        return 2.0f * (dx * dy + dy * dz + dz * dx);
+    }
+
+    inline void ResetBounds(float mins[3], float maxs[3]) {
+        for (int axis = 0; axis < 3; ++axis) {
+            mins[axis] = std::numeric_limits<float>::max();
+            maxs[axis] = -std::numeric_limits<float>::max();
+        }
+    }
+
+    inline void GrowBounds(float mins[3], float maxs[3], const float boxMins[3], const float boxMaxs[3]) {
+        for (int axis = 0; axis < 3; ++axis) {
+            mins[axis] = std::min(mins[axis], boxMins[axis]);
+            maxs[axis] = std::max(maxs[axis], boxMaxs[axis]);
+        }
+    }
+
+    // Squared distance from a point to the nearest point of a box (0 inside)
+    inline float BoxDistanceSquared(const float mins[3], const float maxs[3], const float point[3]) {
+        float distance = 0.0f;
+        for (int axis = 0; axis < 3; ++axis) {
+            const float d = std::max(std::max(mins[axis] - point[axis], 0.0f), point[axis] - maxs[axis]);
+            distance += d * d;
+        }
+        return distance;
+    }
+
+} // namespace
+
+Frustum Frustum::FromView(const float origin[3], const float angles[3], float fovDegrees, float aspect) {
+    const float sp = std::sin(angles[0] * DEG_TO_RAD), cp = std::cos(angles[0] * DEG_TO_RAD);
+    const float sy = std::sin(angles[1] * DEG_TO_RAD), cy = std::cos(angles[1] * DEG_TO_RAD);
+    const float sr = std::sin(angles[2] * DEG_TO_RAD), cr = std::cos(angles[2] * DEG_TO_RAD);
+
+    const float forward[3] = { cp * cy, cp * sy, -sp };
+    const float right[3] = { -sr * sp * cy + cr * sy, -sr * sp * sy - cr * cy, -sr * cp };
+    const float up[3] = { cr * sp * cy + sr * sy, cr * sp * sy - sr * cy, cr * cp };
+
+    const float halfX = std::clamp(fovDegrees, 1.0f, 179.0f) * 0.5f * DEG_TO_RAD;
+    const float halfY = std::atan(std::tan(halfX) / std::max(aspect, 0.01f));
+    const float sx = std::sin(halfX), cx = std::cos(halfX);
+    const float syv = std::sin(halfY), cyv = std::cos(halfY);
+
+    Frustum frustum;
+    for (int axis = 0; axis < 3; ++axis) {
+        frustum.origin[axis] = origin[axis];
+        frustum.planes[0][axis] = forward[axis] * sx + right[axis] * cx;  // left
+        frustum.planes[1][axis] = forward[axis] * sx - right[axis] * cx;  // right
+        frustum.planes[2][axis] = forward[axis] * syv - up[axis] * cyv;   // top
+        frustum.planes[3][axis] = forward[axis] * syv + up[axis] * cyv;   // bottom
+    }
+    for (auto& plane : frustum.planes) {
+        plane[3] = plane[0] * origin[0] + plane[1] * origin[1] + plane[2] * origin[2];
+    }
+    return frustum;
+}
+
+bool Frustum::IntersectsBox(const float mins[3], const float maxs[3]) const {
+    for (const auto& plane : planes) {
+        // Corner furthest along the plane normal
+        const float x = plane[0] >= 0.0f ? maxs[0] : mins[0];
+        const float y = plane[1] >= 0.0f ? maxs[1] : mins[1];
+        const float z = plane[2] >= 0.0f ? maxs[2] : mins[2];
+        if (plane[0] * x + plane[1] * y + plane[2] * z - plane[3] < 0.0f) return false;
+    }
+    return true;
+}
+
+void SpatialIndex::Clear() {
+    m_items.clear();
+    m_nodes.clear();
+    m_boxes.Clear();
+    m_dirty = false;
+}
+
+void SpatialIndex::Add(uint32_t id, const float mins[3], const float maxs[3]) {
+    Item item;
+    item.id = id;
+    for (int axis = 0; axis < 3; ++axis) {
+        item.mins[axis] = std::min(mins[axis], maxs[axis]);
+        item.maxs[axis] = std::max(mins[axis], maxs[axis]);
+        item.center[axis] = (item.mins[axis] + item.maxs[axis]) * 0.5f;
+    }
+    m_items.push_back(item);
+    m_dirty = true;
+}
+
+void SpatialIndex::Build() {
+    m_nodes.clear();
+    m_boxes.Clear();
+    m_dirty = false;
+    if (m_items.empty()) return;
+
+    m_nodes.reserve(m_items.size() * 2);
+    m_nodes.emplace_back();
+    BuildNode(0, 0, static_cast<uint32_t>(m_items.size()));
+
+    m_boxes.Reserve(m_items.size());
+    for (const Item& item : m_items) {
+        m_boxes.Push(item.mins, item.maxs);
+    }
+}
+
+void SpatialIndex::EnsureBuilt() {
+    if (m_dirty) Build();
+}
+
+void SpatialIndex::BuildNode(uint32_t nodeIndex, uint32_t first, uint32_t count) {
+    float mins[3], maxs[3], centerMins[3], centerMaxs[3];
+    ResetBounds(mins, maxs);
+    ResetBounds(centerMins, centerMaxs);
+    for (uint32_t i = first; i < first + count; ++i) {
+        GrowBounds(mins, maxs, m_items[i].mins, m_items[i].maxs);
+        GrowBounds(centerMins, centerMaxs, m_items[i].center, m_items[i].center);
+    }
+
+    Node& node = m_nodes[nodeIndex];
+    std::copy(mins, mins + 3, node.mins);
+    std::copy(maxs, maxs + 3, node.maxs);
+    node.first = first;
+    node.count = count;
+    if (count <= MAX_LEAF_ITEMS) return;
+
+    // Split along the widest centroid axis
+    int axis = 0;
+    for (int a = 1; a < 3; ++a) {
+        if (centerMaxs[a] - centerMins[a] > centerMaxs[axis] - centerMins[axis]) axis = a;
+    }
+    const float extent = centerMaxs[axis] - centerMins[axis];
+
+    uint32_t mid = first + count / 2;
+    if (extent > 0.0f) {
+        // Binned SAH: bucket the centroids, then pick the cheapest bucket boundary
+        struct Bin {
+            float mins[3], maxs[3];
+            uint32_t count = 0;
+        } bins[SAH_BINS];
+        for (Bin& bin : bins) ResetBounds(bin.mins, bin.maxs);
+
+        const float scale = SAH_BINS / extent;
+        auto binOf = [&](const Item& item) {
+            return std::min(SAH_BINS - 1, static_cast<int>((item.center[axis] - centerMins[axis]) * scale));
+        };
+        for (uint32_t i = first; i < first + count; ++i) {
+            Bin& bin = bins[binOf(m_items[i])];
+            GrowBounds(bin.mins, bin.maxs, m_items[i].mins, m_items[i].maxs);
+            ++bin.count;
+        }
+
+        float bestCost = std::numeric_limits<float>::max();
+        int bestSplit = -1;
+        for (int split = 1; split < SAH_BINS; ++split) {
+            float leftMins[3], leftMaxs[3], rightMins[3], rightMaxs[3];
+            ResetBounds(leftMins, leftMaxs);
+            ResetBounds(rightMins, rightMaxs);
+            uint32_t leftCount = 0, rightCount = 0;
+            for (int b = 0; b < split; ++b) {
+                if (!bins[b].count) continue;
+                GrowBounds(leftMins, leftMaxs, bins[b].mins, bins[b].maxs);
+                leftCount += bins[b].count;
+            }
+            for (int b = split; b < SAH_BINS; ++b) {
+                if (!bins[b].count) continue;
+                GrowBounds(rightMins, rightMaxs, bins[b].mins, bins[b].maxs);
+                rightCount += bins[b].count;
+            }
+            if (!leftCount || !rightCount) continue;
+
+            const float cost = SurfaceArea(leftMins, leftMaxs) * leftCount + SurfaceArea(rightMins, rightMaxs) * rightCount;
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestSplit = split;
+            }
+        }
+
+        if (bestSplit > 0) {
+            auto middle = std::partition(m_items.begin() + first, m_items.begin() + first + count,
+                [&](const Item& item) { return binOf(item) < bestSplit; });
+            mid = static_cast<uint32_t>(middle - m_items.begin());
+        }
+    }
+
+    // Degenerate split (coincident centres): fall back to a median split
+    if (mid == first || mid == first + count) {
+        mid = first + count / 2;
+        std::nth_element(m_items.begin() + first, m_items.begin() + mid, m_items.begin() + first + count,
+            [axis](const Item& a, const Item& b) { return a.center[axis] < b.center[axis]; });
+    }
+
+    const uint32_t left = static_cast<uint32_t>(m_nodes.size());
+    m_nodes.emplace_back();
+    m_nodes.emplace_back();
+    m_nodes[nodeIndex].first = left;
+    m_nodes[nodeIndex].count = 0;
+
+    BuildNode(left, first, mid - first);
+    BuildNode(left + 1, mid, first + count - mid);
+}
+
+void SpatialIndex::Query(const Frustum* frustum, const float* distanceOrigin, float maxDistance, std::vector<uint32_t>& out) {
+    EnsureBuilt();
+    if (m_nodes.empty()) return;
+
+    const bool useDistance = distanceOrigin && maxDistance > 0.0f;
+    const float maxDistanceSq = maxDistance * maxDistance;
+
+    CullParams params;
+    params.frustum = frustum;
+    if (useDistance) {
+        std::copy(distanceOrigin, distanceOrigin + 3, params.origin);
+        params.maxDistance = maxDistance;
+    }
+
+    m_stack.clear();
+    m_stack.push_back(0);
+    while (!m_stack.empty()) {
+        const Node& node = m_nodes[m_stack.back()];
+        m_stack.pop_back();
+
+        if (frustum && !frustum->IntersectsBox(node.mins, node.maxs)) continue;
+        if (useDistance && BoxDistanceSquared(node.mins, node.maxs, distanceOrigin) > maxDistanceSq) continue;
+
+        if (node.count == 0) {
+            m_stack.push_back(node.first);
+            m_stack.push_back(node.first + 1);
+            continue;
+        }
+
+        const uint32_t bits = CullBoxGroup(m_boxes, node.first, node.count, params);
+        for (uint32_t lane = 0; lane < node.count; ++lane) {
+            if (bits & (1u << lane)) out.push_back(m_items[node.first + lane].id);
+        }
+    }
+}
+
+void SpatialIndex::QuerySphere(const float center[3], float radius, std::vector<uint32_t>& out) {
+    EnsureBuilt();
+    if (m_nodes.empty()) return;
+
+    const float radiusSq = radius * radius;
+    m_stack.clear();
+    m_stack.push_back(0);
+    while (!m_stack.empty()) {
+        const Node& node = m_nodes[m_stack.back()];
+        m_stack.pop_back();
+        if (BoxDistanceSquared(node.mins, node.maxs, center) > radiusSq) continue;
+
+        if (node.count == 0) {
+            m_stack.push_back(node.first);
+            m_stack.push_back(node.first + 1);
+            continue;
+        }
+
+        for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+            if (BoxDistanceSquared(m_items[i].mins, m_items[i].maxs, center) <= radiusSq) out.push_back(m_items[i].id);
+        }
+    }
+}
+
+} // namespace WorldAPI
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "cull_kernel.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace WorldAPI {
+
+    // View volume used by the culling queries: the four side planes of the view frustum
+    // (inward-facing, n.p - d >= 0 inside). Near/far are handled by the distance limit.
+    struct Frustum {
+        float planes[4][4];
+        float origin[3];
+
+        // Source conventions: angles are (pitch, yaw, roll) in degrees, fov is the horizontal
+        // field of view in degrees and aspect is width / height
+        static Frustum FromView(const float origin[3], const float angles[3], float fovDegrees, float aspect);
+
+        bool IntersectsBox(const float mins[3], const float maxs[3]) const;
+    };
+
+    // Bounding volume hierarchy over renderable AABBs (chunks, displacement batches, prop batches).
+    // Items are added with caller-chosen ids; the tree is rebuilt lazily on the next query after
+    // any change, using binned SAH splits so the per-frame traversal stays shallow. Leaves hold
+    // at most one kernel group of items and are tested with the SIMD culling kernel.
+    class SpatialIndex {
+    public:
+        void Clear();
+        void Add(uint32_t id, const float mins[3], const float maxs[3]);
+        void Build();
+
+        size_t GetItemCount() const { return m_items.size(); }
+        size_t GetNodeCount() const { return m_nodes.size(); }
+
+        // Items inside the frustum (if any) whose centre lies within maxDistance of distanceOrigin
+        // (if maxDistance > 0). Ids are appended to out in traversal order.
+        void Query(const Frustum* frustum, const float* distanceOrigin, float maxDistance, std::vector<uint32_t>& out);
+        // Items whose box touches the sphere
+        void QuerySphere(const float center[3], float radius, std::vector<uint32_t>& out);
+
+    private:
+        struct Item {
+            uint32_t id;
+            float mins[3];
+            float maxs[3];
+            float center[3];
+        };
+
+        struct Node {
+            float mins[3];
+            float maxs[3];
+            uint32_t first; // first child (interior) or first item (leaf)
+            uint32_t count; // 0 for interior nodes
+        };
+
+        void EnsureBuilt();
+        void BuildNode(uint32_t nodeIndex, uint32_t first, uint32_t count);
+
+        std::vector<Item> m_items;
+        std::vector<Node> m_nodes;
+        BoxSoA m_boxes; // item bounds in tree order, so a leaf is one kernel group
+        std::vector<uint32_t> m_stack;
+        bool m_dirty = false;
+    };
+
+} // namespace WorldAPI
@@ -0,0 +1,145 @@
+#include "static_props.h"
+#include "entity_lump.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <tuple>
+
+namespace WorldAPI {
+
+namespace {
+
+    constexpr int STATIC_PROP_COLOR_VERSION = 7;
+    constexpr size_t STATIC_PROP_COLOR_OFFSET = 64; // after forcedFadeScale and the DX/CPU/GPU levels
+    constexpr float DEG_TO_RAD = 3.14159265358979323846f / 180.0f;
+
+    struct BatchKey {
+        std::string model;
+        int32_t skin;
+        bool skybox;
+        int32_t x, y, z;
+
+        bool operator<(const BatchKey& o) const {
+            return std::tie(model, skin, skybox, x, y, z) < std::tie(o.model, o.skin, o.skybox, o.x, o.y, o.z);
+        }
+    };
+
+    inline int LeafArea(const BSPLeaf& leaf) {
+        return leaf.areaFlags & 0x1FF;
+    }
+
+    // Angles are (pitch, yaw, roll) in degrees
+    void AngleMatrix(const BSPVector& angles, const BSPVector& origin, float out[12]) {
+        const float sp = std::sin(angles.x * DEG_TO_RAD), cp = std::cos(angles.x * DEG_TO_RAD);
+        const float sy = std::sin(angles.y * DEG_TO_RAD), cy = std::cos(angles.y * DEG_TO_RAD);
+        const float sr = std::sin(angles.z * DEG_TO_RAD), cr = std::cos(angles.z * DEG_TO_RAD);
+
+        out[0] = cp * cy;
+        out[1] = sr * sp * cy - cr * sy;
+        out[2] = cr * sp * cy + sr * sy;
+        out[3] = origin.x;
+
+        out[4] = cp * sy;
+        out[5] = sr * sp * sy + cr * cy;
+        out[6] = cr * sp * sy - sr * cy;
+        out[7] = origin.y;
+
+        out[8] = -sp;
+        out[9] = sr * cp;
+        out[10] = cr * cp;
+        out[11] = origin.z;
+    }
+
+    // Area of the leaf holding the sky_camera, or -1 when the map has no 3D skybox
+    int FindSkyboxArea(const BSPFile& map) {
+        for (const BSPEntity& entity : ParseEntities(map.Entities())) {
+            if (entity.Get("classname") != "sky_camera") continue;
+
+            float origin[3];
+            if (!entity.GetVector("origin", origin)) return -1;
+
+            const int leaf = map.FindLeaf(origin[0], origin[1], origin[2]);
+            return leaf >= 0 ? LeafArea(map.Leafs()[leaf]) : -1;
+        }
+        return -1;
+    }
+
+} // namespace
+
+std::vector<StaticPropBatch> BuildStaticPropBatches(const BSPFile& map, int binSize) {
+    std::vector<StaticPropBatch> batches;
+
+    auto props = map.StaticProps();
+    auto propLeaves = map.StaticPropLeaves();
+    auto leafs = map.Leafs();
+    const auto& models = map.StaticPropModels();
+    if (props.empty()) return batches;
+
+    const double bin = static_cast<double>(binSize > 0 ? binSize : 8192);
+    const int skyboxArea = FindSkyboxArea(map);
+    const bool hasColor = map.GetStaticPropVersion() >= STATIC_PROP_COLOR_VERSION &&
+                          props.stride() >= STATIC_PROP_COLOR_OFFSET + 4;
+
+    std::map<BatchKey, size_t> batchLookup;
+    for (const BSPStaticProp& prop : props) {
+        if (prop.propType >= models.size() || models[prop.propType].empty()) continue;
+
+        bool skybox = false;
+        if (skyboxArea >= 0 && prop.leafCount > 0 && propLeaves.valid(prop.firstLeaf)) {
+            const uint16_t leaf = propLeaves[prop.firstLeaf];
+            skybox = leafs.valid(leaf) && LeafArea(leafs[leaf]) == skyboxArea;
+        }
+
+        BatchKey key {
+            std::string(models[prop.propType]),
+            prop.skin,
+            skybox,
+            static_cast<int32_t>(std::floor(prop.origin.x / bin)),
+            static_cast<int32_t>(std::floor(prop.origin.y / bin)),
+            static_cast<int32_t>(std::floor(prop.origin.z / bin))
+        };
+
+        auto it = batchLookup.find(key);
+        if (it == batchLookup.end()) {
+            StaticPropBatch created;
+            created.model = key.model;
+            created.skin = key.skin;
+            created.skybox = key.skybox;
+            created.bin[0] = key.x;
+            created.bin[1] = key.y;
+            created.bin[2] = key.z;
+            for (int axis = 0; axis < 3; ++axis) {
+                created.mins[axis] = std::numeric_limits<float>::max();
+                created.maxs[axis] = -std::numeric_limits<float>::max();
+            }
+            it = batchLookup.emplace(std::move(key), batches.size()).first;
+            batches.push_back(std::move(created));
+        }
+
+        StaticPropBatch& batch = batches[it->second];
+        StaticPropInstance instance;
+        AngleMatrix(prop.angles, prop.origin, instance.transform);
+        std::memset(instance.color, 255, sizeof(instance.color));
+        if (hasColor) {
+            std::memcpy(instance.color, reinterpret_cast<const uint8_t*>(&prop) + STATIC_PROP_COLOR_OFFSET, sizeof(instance.color));
+        }
+        batch.instances.push_back(instance);
+
+        const float origin[3] = { prop.origin.x, prop.origin.y, prop.origin.z };
+        for (int axis = 0; axis < 3; ++axis) {
+            batch.mins[axis] = std::min(batch.mins[axis], origin[axis]);
+            batch.maxs[axis] = std::max(batch.maxs[axis], origin[axis]);
+        }
+    }
+
+    // Model-major order so every model's meshes are built once, right before first use
+    std::stable_sort(batches.begin(), batches.end(), [](const StaticPropBatch& a, const StaticPropBatch& b) {
+        return std::tie(a.model, a.skin) < std::tie(b.model, b.skin);
+    });
+    return batches;
+}
+
+} // namespace WorldAPI
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "bsp_file.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace WorldAPI {
+
+    struct StaticPropInstance {
+        // Row-major 3x4 model-to-world transform (rotation columns + origin), as AngleMatrix builds it
+        float transform[12];
+        uint8_t color[4]; // diffuse modulation, white for lump versions without it
+    };
+
+    // Every instance of one (model, skin) inside one spatial bin, drawn with the same meshes
+    struct StaticPropBatch {
+        std::string model;
+        int32_t skin = 0;
+        bool skybox = false; // inside the 3D skybox area
+        int32_t bin[3] = { 0, 0, 0 };
+        // Bounds of the instance origins; callers pad them by the model radius
+        float mins[3] = { 0, 0, 0 };
+        float maxs[3] = { 0, 0, 0 };
+        std::vector<StaticPropInstance> instances;
+    };
+
+    // Groups the static prop lump into instance batches. Props sharing the sky_camera's area are
+    // flagged as skybox props; batches are sorted by model so mesh caches fill in order.
+    std::vector<StaticPropBatch> BuildStaticPropBatches(const BSPFile& map, int binSize);
+
+} // namespace WorldAPI
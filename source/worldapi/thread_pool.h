@@ -0,0 +1,44 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace WorldAPI {
+
+    // Fixed set of worker threads shared by the native world passes. Work items must not
+    // touch the Lua state; results are handed back to Lua on the main thread.
+    class ThreadPool {
+    public:
+        // 0 = one worker per hardware thread, minus one for the game thread
+        explicit ThreadPool(size_t threadCount = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        size_t GetThreadCount() const { return m_workers.size(); }
+
+        // Queues a task and returns immediately
+        void Enqueue(std::function<void()> task);
+
+        // Runs fn(i) for i in [0, count) across the workers and the calling thread,
+        // returning once every index has been processed. If fn throws, the remaining indices
+        // still run and the first exception is rethrown here.
+        void ParallelFor(size_t count, const std::function<void(size_t)>& fn);
+
+    private:
+        void WorkerLoop();
+
+        std::vector<std::thread> m_workers;
+        std::deque<std::function<void()>> m_tasks;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        bool m_stopping;
+    };
+
+} // namespace WorldAPI
@@ -0,0 +1,78 @@
+#include "vertex_kernel.h"
+
+#include <cmath>
+#include <limits>
+
+#ifdef WORLDAPI_VERTEX_SSE
+#include <emmintrin.h>
+#endif
+
+namespace WorldAPI {
+
+size_t ValidatePositions(const float* positions, size_t count, size_t stride, VertexBounds& bounds,
+                         std::vector<uint32_t>* outRejected, float limit) {
+    const float inf = std::numeric_limits<float>::infinity();
+    for (int axis = 0; axis < 3; ++axis) {
+        bounds.mins[axis] = inf;
+        bounds.maxs[axis] = -inf;
+    }
+    if (outRejected) outRejected->assign((count + 31) / 32, 0u);
+    if (count == 0 || stride < 3) return 0;
+
+    size_t rejected = 0;
+    auto reject = [&](size_t i) {
+        ++rejected;
+        if (outRejected) (*outRejected)[i / 32] |= 1u << (i % 32);
+    };
+
+#ifdef WORLDAPI_VERTEX_SSE
+    // One vertex per register, x/y/z in lanes 0-2. |v| <= limit is false for NaN, so a single
+    // compare covers both checks; lane 3 holds whatever follows z and is ignored.
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128 limits = _mm_set1_ps(limit);
+    __m128 mins = _mm_set1_ps(inf);
+    __m128 maxs = _mm_set1_ps(-inf);
+
+    const size_t last = count - 1;
+    for (size_t i = 0; i < count; ++i) {
+        const float* p = positions + i * stride;
+        // Every vertex but the last is followed by at least one more float, so a 4-wide load
+        // stays inside the array
+        const __m128 v = i < last ? _mm_loadu_ps(p) : _mm_setr_ps(p[0], p[1], p[2], 0.0f);
+        const __m128 inRange = _mm_cmple_ps(_mm_and_ps(v, absMask), limits);
+        if ((_mm_movemask_ps(inRange) & 0x7) != 0x7) {
+            reject(i);
+            continue;
+        }
+        mins = _mm_min_ps(mins, v);
+        maxs = _mm_max_ps(maxs, v);
+    }
+
+    float lanes[4];
+    _mm_storeu_ps(lanes, mins);
+    for (int axis = 0; axis < 3; ++axis) bounds.mins[axis] = lanes[axis];
+    _mm_storeu_ps(lanes, maxs);
+    for (int axis = 0; axis < 3; ++axis) bounds.maxs[axis] = lanes[axis];
+#else
+    for (size_t i = 0; i < count; ++i) {
+        const float* p = positions + i * stride;
+        bool valid = true;
+        for (int axis = 0; axis < 3; ++axis) {
+            // Written as !(a <= b) so NaN fails too
+            if (!(std::fabs(p[axis]) <= limit)) valid = false;
+        }
+        if (!valid) {
+            reject(i);
+            continue;
+        }
+        for (int axis = 0; axis < 3; ++axis) {
+            if (p[axis] < bounds.mins[axis]) bounds.mins[axis] = p[axis];
+            if (p[axis] > bounds.maxs[axis]) bounds.maxs[axis] = p[axis];
+        }
+    }
+#endif
+
+    return rejected;
+}
+
+} // namespace WorldAPI
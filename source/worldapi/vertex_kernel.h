@@ -0,0 +1,30 @@
+#pragma once
+
+#include "bsp_format.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WORLDAPI_VERTEX_SSE 1
+#endif
+
+namespace WorldAPI {
+
+    // Bounds of the accepted vertices; mins stay at +inf and maxs at -inf when there are none
+    struct VertexBounds {
+        float mins[3];
+        float maxs[3];
+    };
+
+    // One pass over packed positions: positions[i * stride + 0..2] is vertex i, stride counted
+    // in floats and at least 3 (3 for bare xyz, 8 for MeshVertex). A vertex is rejected when
+    // any coordinate is NaN or its magnitude exceeds limit, the test RenderCore.ValidateVertex
+    // applies.
+    // If outRejected is given it receives a bitmask (bit i of word i / 32 set for rejected
+    // vertex i). Returns the number of rejected vertices.
+    size_t ValidatePositions(const float* positions, size_t count, size_t stride, VertexBounds& bounds,
+                             std::vector<uint32_t>* outRejected = nullptr, float limit = BSP_MAX_COORD);
+
+} // namespace WorldAPI
@@ -0,0 +1,130 @@
+#include "visibility.h"
+
+#include <cstring>
+
+namespace WorldAPI {
+
+//=============================================================================
+// ClusterVisibility
+//=============================================================================
+bool ClusterVisibility::Load(const BSPFile& map) {
+    Clear();
+
+    const std::string_view lump = map.Visibility();
+    if (lump.size() < sizeof(int32_t)) return false;
+
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(lump.data());
+    int32_t clusterCount;
+    std::memcpy(&clusterCount, data, sizeof(clusterCount));
+    if (clusterCount <= 0) return false;
+
+    const size_t headerSize = sizeof(int32_t) + static_cast<size_t>(clusterCount) * 2 * sizeof(int32_t);
+    if (headerSize > lump.size()) return false;
+
+    const size_t rowBytes = (static_cast<size_t>(clusterCount) + 7) / 8;
+    m_clusterCount = static_cast<size_t>(clusterCount);
+    m_wordsPerRow = (m_clusterCount + 63) / 64;
+    m_rows.assign(m_clusterCount * m_wordsPerRow, 0);
+
+    for (size_t cluster = 0; cluster < m_clusterCount; ++cluster) {
+        int32_t offset;
+        std::memcpy(&offset, data + sizeof(int32_t) + cluster * 2 * sizeof(int32_t), sizeof(offset));
+        uint8_t* row = reinterpret_cast<uint8_t*>(&m_rows[cluster * m_wordsPerRow]);
+
+        if (offset <= 0 || static_cast<size_t>(offset) >= lump.size()) {
+            // No row stored: the engine treats the cluster as seeing everything
+            std::memset(row, 0xFF, rowBytes);
+            continue;
+        }
+
+        // Non-zero bytes are literal; a zero byte is followed by a run length of zero bytes.
+        // Rows are little-endian bytes, so writing bytes into the words keeps bit order intact.
+        const uint8_t* in = data + offset;
+        const uint8_t* end = data + lump.size();
+        size_t out = 0;
+        while (out < rowBytes && in < end) {
+            if (*in) {
+                row[out++] = *in++;
+                continue;
+            }
+            if (in + 1 >= end) break;
+            out += in[1];
+            in += 2;
+        }
+    }
+
+    // Clear padding bits past the last cluster so word-wide tests stay exact
+    if (m_clusterCount % 64) {
+        const uint64_t tailMask = (uint64_t(1) << (m_clusterCount % 64)) - 1;
+        for (size_t cluster = 0; cluster < m_clusterCount; ++cluster) {
+            m_rows[cluster * m_wordsPerRow + m_wordsPerRow - 1] &= tailMask;
+        }
+    }
+
+    return true;
+}
+
+void ClusterVisibility::Clear() {
+    m_clusterCount = 0;
+    m_wordsPerRow = 0;
+    m_rows.clear();
+    m_rows.shrink_to_fit();
+}
+
+const uint64_t* ClusterVisibility::GetRow(int cluster) const {
+    if (cluster < 0 || static_cast<size_t>(cluster) >= m_clusterCount) return nullptr;
+    return &m_rows[static_cast<size_t>(cluster) * m_wordsPerRow];
+}
+
+bool ClusterVisibility::IsVisible(int fromCluster, int toCluster) const {
+    const uint64_t* row = GetRow(fromCluster);
+    if (!row || toCluster < 0 || static_cast<size_t>(toCluster) >= m_clusterCount) return true;
+    return (row[toCluster >> 6] >> (toCluster & 63)) & 1;
+}
+
+//=============================================================================
+// ChunkClusterMasks
+//=============================================================================
+void ChunkClusterMasks::Reset(size_t clusterCount) {
+    m_wordsPerMask = (clusterCount + 63) / 64;
+    m_chunkCount = 0;
+    m_masks.clear();
+}
+
+size_t ChunkClusterMasks::Add(const std::vector<int32_t>& clusters) {
+    const size_t index = m_chunkCount++;
+    m_masks.resize(m_chunkCount * m_wordsPerMask, 0);
+
+    uint64_t* mask = m_masks.data() + index * m_wordsPerMask;
+    for (int32_t cluster : clusters) {
+        if (cluster < 0 || static_cast<size_t>(cluster) >= m_wordsPerMask * 64) continue;
+        mask[cluster >> 6] |= uint64_t(1) << (cluster & 63);
+    }
+    return index;
+}
+
+void ChunkClusterMasks::QueryVisible(const ClusterVisibility& visibility, int viewCluster, std::vector<uint32_t>& out) const {
+    const uint64_t* row = visibility.GetRow(viewCluster);
+    QueryVisibleRow(visibility.GetWordsPerRow() == m_wordsPerMask ? row : nullptr, out);
+}
+
+void ChunkClusterMasks::QueryVisibleRow(const uint64_t* row, std::vector<uint32_t>& out) const {
+    out.clear();
+    out.reserve(m_chunkCount);
+
+    if (!row) {
+        for (size_t i = 0; i < m_chunkCount; ++i) out.push_back(static_cast<uint32_t>(i));
+        return;
+    }
+
+    const uint64_t* mask = m_masks.data();
+    for (size_t i = 0; i < m_chunkCount; ++i, mask += m_wordsPerMask) {
+        uint64_t hit = 0;
+        for (size_t w = 0; w < m_wordsPerMask && !hit; ++w) {
+            hit = mask[w] & row[w];
+        }
+        if (hit) out.push_back(static_cast<uint32_t>(i));
+    }
+}
+
+} // namespace WorldAPI
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "bsp_file.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace WorldAPI {
+
+    // Decompressed potentially-visible-set of every cluster, one bit row per cluster
+    // packed into 64-bit words so rows can be ANDed against chunk masks a word at a time.
+    class ClusterVisibility {
+    public:
+        // Decodes the RLE PVS rows of the map's visibility lump. Returns false when the
+        // map has no vis data, in which case every cluster is treated as visible.
+        bool Load(const BSPFile& map);
+        void Clear();
+
+        bool IsLoaded() const { return m_clusterCount > 0; }
+        size_t GetClusterCount() const { return m_clusterCount; }
+        size_t GetWordsPerRow() const { return m_wordsPerRow; }
+
+        bool IsVisible(int fromCluster, int toCluster) const;
+        // nullptr for clusters outside the map
+        const uint64_t* GetRow(int cluster) const;
+
+    private:
+        size_t m_clusterCount = 0;
+        size_t m_wordsPerRow = 0;
+        std::vector<uint64_t> m_rows;
+    };
+
+    // Cluster bitmasks for a set of render chunks, queried against a ClusterVisibility row
+    class ChunkClusterMasks {
+    public:
+        void Reset(size_t clusterCount);
+        void Clear() { Reset(0); }
+
+        // Adds a chunk touching the given clusters; returns its 0-based index
+        size_t Add(const std::vector<int32_t>& clusters);
+        size_t GetChunkCount() const { return m_chunkCount; }
+
+        // Writes the indices of chunks sharing at least one cluster with the view cluster's
+        // PVS. Without vis data or with the view outside the map every chunk is visible.
+        void QueryVisible(const ClusterVisibility& visibility, int viewCluster, std::vector<uint32_t>& out) const;
+        // Same against any row of GetWordsPerMask() words (a portal flow result); nullptr
+        // makes every chunk visible
+        void QueryVisibleRow(const uint64_t* row, std::vector<uint32_t>& out) const;
+        size_t GetWordsPerMask() const { return m_wordsPerMask; }
+
+    private:
+        size_t m_wordsPerMask = 0;
+        size_t m_chunkCount = 0;
+        std::vector<uint64_t> m_masks;
+    };
+
+} // namespace WorldAPI
@@ -0,0 +1,324 @@
+#include "world_builder.h"
+#include "material_filter.h"
+#include "vertex_kernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <set>
+#include <tuple>
+
+namespace WorldAPI {
+
+namespace {
+
+    constexpr int32_t HIDDEN_SURFACE_FLAGS = SURF_NODRAW | SURF_SKY | SURF_SKY2D | SURF_HINT | SURF_SKIP;
+
+    struct GroupKey {
+        bool translucent;
+        int32_t x, y, z;
+        std::string material;
+
+        bool operator<(const GroupKey& o) const {
+            return std::tie(translucent, x, y, z, material) < std::tie(o.translucent, o.x, o.y, o.z, o.material);
+        }
+    };
+
+    // Interleaves the low 21 bits of three non-negative coordinates
+    uint64_t MortonCode(uint32_t x, uint32_t y, uint32_t z) {
+        auto spread = [](uint64_t v) {
+            v &= 0x1FFFFF;
+            v = (v | (v << 32)) & 0x1F00000000FFFFull;
+            v = (v | (v << 16)) & 0x1F0000FF0000FFull;
+            v = (v | (v << 8)) & 0x100F00F00F00F00Full;
+            v = (v | (v << 4)) & 0x10C30C30C30C30C3ull;
+            v = (v | (v << 2)) & 0x1249249249249249ull;
+            return v;
+        };
+        return spread(x) | (spread(y) << 1) | (spread(z) << 2);
+    }
+
+    inline bool IsValidCoord(float value) {
+        return !std::isnan(value) && std::fabs(value) <= BSP_MAX_COORD;
+    }
+
+} // namespace
+
+int DetermineChunkSize(size_t totalFaces) {
+    if (totalFaces == 0) return 65536;
+    // Base chunk size on face density, but keep within reasonable bounds
+    const double density = static_cast<double>(totalFaces) / (16384.0 * 16384.0 * 16384.0);
+    const double size = std::floor(1.0 / density * 32768.0);
+    return static_cast<int>(std::max(4096.0, std::min(65536.0, size)));
+}
+
+bool TriangulateFace(const BSPFile& map, const BSPFace& face, std::vector<MeshVertex>& out) {
+    if (face.numedges < 3) return false;
+
+    auto planes = map.Planes();
+    auto texInfos = map.TexInfo();
+    auto texDatas = map.TexData();
+    if (!planes.valid(face.planenum) || !texInfos.valid(face.texinfo)) return false;
+
+    const BSPPlane& plane = planes[face.planenum];
+    const BSPTexInfo& texInfo = texInfos[face.texinfo];
+    float width = 1.0f, height = 1.0f;
+    if (texDatas.valid(texInfo.texdata)) {
+        const BSPTexData& texData = texDatas[texInfo.texdata];
+        if (texData.width > 0) width = static_cast<float>(texData.width);
+        if (texData.height > 0) height = static_cast<float>(texData.height);
+    }
+
+    const float sign = face.side ? -1.0f : 1.0f;
+    const float normal[3] = { plane.normal.x * sign, plane.normal.y * sign, plane.normal.z * sign };
+
+    MeshVertex polygon[64];
+    const int count = std::min<int>(face.numedges, 64);
+    for (int i = 0; i < count; ++i) {
+        BSPVector pos;
+        if (!map.GetFaceVertex(face, i, pos)) return false;
+        if (!IsValidCoord(pos.x) || !IsValidCoord(pos.y) || !IsValidCoord(pos.z)) return false;
+
+        MeshVertex& v = polygon[i];
+        v.pos[0] = pos.x; v.pos[1] = pos.y; v.pos[2] = pos.z;
+        v.normal[0] = normal[0]; v.normal[1] = normal[1]; v.normal[2] = normal[2];
+
+        const float* s = texInfo.textureVecs[0];
+        const float* t = texInfo.textureVecs[1];
+        v.uv[0] = (pos.x * s[0] + pos.y * s[1] + pos.z * s[2] + s[3]) / width;
+        v.uv[1] = (pos.x * t[0] + pos.y * t[1] + pos.z * t[2] + t[3]) / height;
+    }
+
+    for (int i = 1; i + 1 < count; ++i) {
+        out.push_back(polygon[0]);
+        out.push_back(polygon[i]);
+        out.push_back(polygon[i + 1]);
+    }
+    return true;
+}
+
+WorldBuildResult BuildWorldChunks(const BSPFile& map, const WorldBuildSettings& settings, ThreadPool& pool,
+                                  BuildProgress* progress) {
+    WorldBuildResult result;
+
+    auto faces = map.Faces();
+    auto leafs = map.Leafs();
+    auto leafFaces = map.LeafFaces();
+    auto texInfos = map.TexInfo();
+    if (faces.empty()) return result;
+
+    // Model 0 is the world; faces of brush entities belong to the other models
+    size_t worldFirst = 0, worldEnd = faces.size();
+    if (!map.Models().empty()) {
+        const BSPModel& world = map.Models()[0];
+        worldFirst = static_cast<size_t>(std::max(0, world.firstface));
+        worldEnd = std::min(faces.size(), worldFirst + static_cast<size_t>(std::max(0, world.numfaces)));
+    }
+
+    size_t totalFaces = 0;
+    for (const BSPLeaf& leaf : leafs) {
+        if (leaf.cluster >= 0) totalFaces += leaf.numleaffaces;
+    }
+    result.chunkSize = settings.chunkSize > 0 ? settings.chunkSize : DetermineChunkSize(totalFaces);
+    const double chunkSize = static_cast<double>(result.chunkSize);
+
+    // Surface verdicts are per texinfo, so filter each texinfo once: -1 unknown, 0 rejected, 1 opaque, 2 translucent
+    const MaterialFilter filter(settings.whitelist, settings.blacklist);
+    std::vector<int8_t> texInfoVerdict(texInfos.size(), -1);
+    auto classify = [&](int16_t texInfoIndex) -> int8_t {
+        if (!texInfos.valid(texInfoIndex)) return 0;
+        int8_t& verdict = texInfoVerdict[texInfoIndex];
+        if (verdict >= 0) return verdict;
+
+        const BSPTexInfo& texInfo = texInfos[texInfoIndex];
+        const std::string_view name = map.GetTexDataName(texInfo.texdata);
+        if ((texInfo.flags & HIDDEN_SURFACE_FLAGS) || name.empty() ||
+            IsSkyboxMaterialName(name) || !filter.IsAllowed(name)) {
+            verdict = 0;
+        } else {
+            verdict = (texInfo.flags & SURF_TRANS) ? 2 : 1;
+        }
+        return verdict;
+    };
+
+    std::map<GroupKey, size_t> groupLookup;
+    std::vector<int32_t> faceGroup(faces.size(), -2); // -2 unvisited, -1 rejected
+    std::vector<std::set<int32_t>> groupClusters;
+
+    for (const BSPLeaf& leaf : leafs) {
+        if (leaf.cluster < 0) continue; // outside the map
+
+        for (uint32_t i = 0; i < leaf.numleaffaces; ++i) {
+            const size_t leafFace = static_cast<size_t>(leaf.firstleafface) + i;
+            if (!leafFaces.valid(static_cast<int64_t>(leafFace))) break;
+
+            const uint16_t faceIndex = leafFaces[leafFace];
+            if (faceIndex < worldFirst || faceIndex >= worldEnd) continue;
+
+            int32_t& group = faceGroup[faceIndex];
+            if (group == -2) {
+                group = -1;
+                const BSPFace& face = faces[faceIndex];
+                const int8_t verdict = face.dispinfo >= 0 ? 0 : classify(face.texinfo);
+                if (verdict == 0) {
+                    ++result.rejectedFaces;
+                    continue;
+                }
+
+                // Bin by the polygon centre
+                double center[3] = { 0, 0, 0 };
+                int corners = 0;
+                for (int c = 0; c < face.numedges; ++c) {
+                    BSPVector pos;
+                    if (!map.GetFaceVertex(face, c, pos)) continue;
+                    center[0] += pos.x; center[1] += pos.y; center[2] += pos.z;
+                    ++corners;
+                }
+                if (corners == 0) {
+                    ++result.rejectedFaces;
+                    continue;
+                }
+
+                GroupKey key {
+                    verdict == 2,
+                    static_cast<int32_t>(std::floor(center[0] / corners / chunkSize)),
+                    static_cast<int32_t>(std::floor(center[1] / corners / chunkSize)),
+                    static_cast<int32_t>(std::floor(center[2] / corners / chunkSize)),
+                    std::string(map.GetFaceMaterial(face))
+                };
+
+                auto it = groupLookup.find(key);
+                if (it == groupLookup.end()) {
+                    it = groupLookup.emplace(std::move(key), result.groups.size()).first;
+                    WorldChunkGroup created;
+                    created.chunk[0] = it->first.x;
+                    created.chunk[1] = it->first.y;
+                    created.chunk[2] = it->first.z;
+                    created.material = it->first.material;
+                    created.translucent = it->first.translucent;
+                    result.groups.push_back(std::move(created));
+                    groupClusters.emplace_back();
+                }
+
+                group = static_cast<int32_t>(it->second);
+                result.groups[group].faces.push_back(faceIndex);
+            }
+
+            if (group >= 0) groupClusters[group].insert(leaf.cluster);
+        }
+    }
+
+    // Cluster membership is tracked per chunk, shared by all of its material groups
+    std::map<std::tuple<bool, int32_t, int32_t, int32_t>, std::set<int32_t>> chunkClusters;
+    for (size_t g = 0; g < result.groups.size(); ++g) {
+        const WorldChunkGroup& group = result.groups[g];
+        auto& set = chunkClusters[std::make_tuple(group.translucent, group.chunk[0], group.chunk[1], group.chunk[2])];
+        set.insert(groupClusters[g].begin(), groupClusters[g].end());
+    }
+
+    std::vector<size_t> invalidFaces(result.groups.size(), 0);
+    if (progress) progress->SetTotal(result.groups.size());
+    pool.ParallelFor(result.groups.size(), [&](size_t g) {
+        if (progress && progress->IsCancelled()) return;
+        WorldChunkGroup& group = result.groups[g];
+        std::sort(group.faces.begin(), group.faces.end());
+
+        const auto& clusters = chunkClusters.at(std::make_tuple(group.translucent, group.chunk[0], group.chunk[1], group.chunk[2]));
+        group.clusters.assign(clusters.begin(), clusters.end());
+
+        size_t vertexEstimate = 0;
+        for (uint32_t faceIndex : group.faces) vertexEstimate += (std::max<int>(faces[faceIndex].numedges, 2) - 2) * 3;
+        group.vertices.reserve(vertexEstimate);
+
+        for (uint32_t faceIndex : group.faces) {
+            if (!TriangulateFace(map, faces[faceIndex], group.vertices)) ++invalidFaces[g];
+        }
+
+        // Every vertex already passed validation, so this is only the bounds pass
+        VertexBounds bounds;
+        ValidatePositions(group.vertices.empty() ? nullptr : group.vertices[0].pos, group.vertices.size(),
+                          sizeof(MeshVertex) / sizeof(float), bounds);
+        for (int axis = 0; axis < 3; ++axis) {
+            group.mins[axis] = group.vertices.empty() ? 0.0f : bounds.mins[axis];
+            group.maxs[axis] = group.vertices.empty() ? 0.0f : bounds.maxs[axis];
+        }
+        if (progress) progress->Advance();
+    });
+
+    for (size_t g = 0; g < result.groups.size(); ++g) {
+        result.faceCount += result.groups[g].faces.size() - invalidFaces[g];
+        result.rejectedFaces += invalidFaces[g];
+    }
+
+    // Drop groups whose faces were all invalid
+    result.groups.erase(std::remove_if(result.groups.begin(), result.groups.end(),
+        [](const WorldChunkGroup& group) { return group.vertices.empty(); }), result.groups.end());
+
+    return result;
+}
+
+std::vector<WorldBatch> PlanWorldBatches(const WorldBuildResult& world, size_t maxVertices, float maxExtent) {
+    std::vector<WorldBatch> batches;
+    if (world.groups.empty()) return batches;
+
+    int32_t minChunk[3];
+    for (int axis = 0; axis < 3; ++axis) minChunk[axis] = world.groups[0].chunk[axis];
+    for (const WorldChunkGroup& group : world.groups) {
+        for (int axis = 0; axis < 3; ++axis) minChunk[axis] = std::min(minChunk[axis], group.chunk[axis]);
+    }
+
+    // Bucket by (translucent, material), chunks in Morton order inside each bucket
+    std::vector<std::pair<uint64_t, uint32_t>> order;
+    order.reserve(world.groups.size());
+    for (uint32_t i = 0; i < world.groups.size(); ++i) {
+        const WorldChunkGroup& group = world.groups[i];
+        order.emplace_back(MortonCode(static_cast<uint32_t>(group.chunk[0] - minChunk[0]),
+                                      static_cast<uint32_t>(group.chunk[1] - minChunk[1]),
+                                      static_cast<uint32_t>(group.chunk[2] - minChunk[2])), i);
+    }
+    std::sort(order.begin(), order.end(), [&](const auto& a, const auto& b) {
+        const WorldChunkGroup& ga = world.groups[a.second];
+        const WorldChunkGroup& gb = world.groups[b.second];
+        return std::tie(ga.translucent, ga.material, a.first, a.second) < std::tie(gb.translucent, gb.material, b.first, b.second);
+    });
+
+    auto fits = [&](const WorldBatch& batch, const WorldChunkGroup& group) {
+        if (batch.material != group.material || batch.translucent != group.translucent) return false;
+        if (batch.vertexCount + group.vertices.size() > maxVertices) return false;
+        if (maxExtent <= 0.0f) return true;
+        for (int axis = 0; axis < 3; ++axis) {
+            if (std::max(batch.maxs[axis], group.maxs[axis]) - std::min(batch.mins[axis], group.mins[axis]) > maxExtent) return false;
+        }
+        return true;
+    };
+
+    for (const auto& entry : order) {
+        const WorldChunkGroup& group = world.groups[entry.second];
+        if (batches.empty() || !fits(batches.back(), group)) {
+            WorldBatch batch;
+            batch.material = group.material;
+            batch.translucent = group.translucent;
+            std::copy(group.mins, group.mins + 3, batch.mins);
+            std::copy(group.maxs, group.maxs + 3, batch.maxs);
+            batches.push_back(std::move(batch));
+        }
+
+        WorldBatch& batch = batches.back();
+        for (int axis = 0; axis < 3; ++axis) {
+            batch.mins[axis] = std::min(batch.mins[axis], group.mins[axis]);
+            batch.maxs[axis] = std::max(batch.maxs[axis], group.maxs[axis]);
+        }
+        batch.clusters.insert(batch.clusters.end(), group.clusters.begin(), group.clusters.end());
+        batch.groups.push_back(entry.second);
+        batch.vertexCount += group.vertices.size();
+    }
+
+    for (WorldBatch& batch : batches) {
+        std::sort(batch.clusters.begin(), batch.clusters.end());
+        batch.clusters.erase(std::unique(batch.clusters.begin(), batch.clusters.end()), batch.clusters.end());
+    }
+    return batches;
+}
+
+} // namespace WorldAPI
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "bsp_file.h"
+#include "build_progress.h"
+#include "mesh_simplifier.h"
+#include "thread_pool.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace WorldAPI {
+
+    struct WorldBuildSettings {
+        // Chunk edge length in units; 0 picks one from the face count like the Lua builder did
+        int chunkSize = 0;
+        std::string whitelist;
+        std::string blacklist;
+        // Reuse/refresh the on-disk geometry cache (data/remixworld/)
+        bool useCache = true;
+        // LOD chains simplified right after the build, one level per ratio, for groups of at least
+        // lodMinVertices vertices; none when empty. Not part of the cache.
+        std::vector<float> lodRatios;
+        size_t lodMinVertices = 0;
+        SimplifyOptions lodOptions;
+    };
+
+    // One (chunk, material) bucket of world brush faces, triangulated and ready to upload
+    struct WorldChunkGroup {
+        int32_t chunk[3] = { 0, 0, 0 };
+        std::string material;
+        bool translucent = false;
+        float mins[3] = { 0, 0, 0 };
+        float maxs[3] = { 0, 0, 0 };
+        // PVS clusters of every leaf that references a face in this chunk (sorted, unique)
+        std::vector<int32_t> clusters;
+        std::vector<uint32_t> faces;
+        // Triangle list (3 vertices per triangle)
+        std::vector<MeshVertex> vertices;
+    };
+
+    struct WorldBuildResult {
+        int chunkSize = 0;
+        size_t faceCount = 0;
+        size_t rejectedFaces = 0;
+        std::vector<WorldChunkGroup> groups;
+    };
+
+    // Whole groups of one material from neighbouring chunks, uploaded as one shared mesh
+    struct WorldBatch {
+        std::string material;
+        bool translucent = false;
+        float mins[3] = { 0, 0, 0 };
+        float maxs[3] = { 0, 0, 0 };
+        std::vector<int32_t> clusters;  // union of the member groups' clusters (sorted, unique)
+        std::vector<uint32_t> groups;   // indices into WorldBuildResult::groups, in upload order
+        size_t vertexCount = 0;
+    };
+
+    // Packs the groups of each (material, translucency) into batches of at most maxVertices,
+    // walking chunks in Morton order so a batch covers a compact region no wider than maxExtent
+    // on any axis (0 = unbounded). Groups bigger than maxVertices get a batch of their own.
+    std::vector<WorldBatch> PlanWorldBatches(const WorldBuildResult& world, size_t maxVertices, float maxExtent);
+
+    // Same heuristic as DetermineOptimalChunkSize in cl_rtx_meshed_world_renderer.lua
+    int DetermineChunkSize(size_t totalFaces);
+
+    // Appends a fan triangulation of a brush face (position, plane normal, texture UV).
+    // Returns false without appending when a vertex is NaN or outside the +-16384 world limits.
+    bool TriangulateFace(const BSPFile& map, const BSPFace& face, std::vector<MeshVertex>& out);
+
+    // Native port of BuildMapMeshes: filters world faces (no displacements, brush entities,
+    // nodraw/sky surfaces or filtered materials), bins them into chunks by face centre,
+    // groups them per material and triangulates the groups in parallel. With a progress object
+    // it reports one unit per group and stops early once cancelled.
+    WorldBuildResult BuildWorldChunks(const BSPFile& map, const WorldBuildSettings& settings, ThreadPool& pool,
+                                      BuildProgress* progress = nullptr);
+
+} // namespace WorldAPI
@@ -0,0 +1,564 @@
+#include "worldapi.h"
+#include "game_paths.h"
+#include "geometry_cache.h"
+#include <tier0/dbg.h>
+
+#include <chrono>
+#include <cstring>
+#include <exception>
+
+namespace WorldAPI {
+
+//=============================================================================
+// WorldAPI Implementation
+//=============================================================================
+WorldAPI& WorldAPI::Instance() {
+    static WorldAPI instance;
+    return instance;
+}
+
+WorldAPI::WorldAPI()
+    : m_lua(nullptr)
+    , m_initialized(false) {
+}
+
+WorldAPI::~WorldAPI() {
+    Shutdown();
+}
+
+bool WorldAPI::Initialize(GarrysMod::Lua::ILuaBase* LUA) {
+    if (m_initialized) {
+        Msg("[WorldAPI] Already initialized\n");
+        return false;
+    }
+
+    if (!LUA) {
+        Error("[WorldAPI] Invalid parameters for initialization\n");
+        return false;
+    }
+
+    m_lua = LUA;
+
+    m_geometryManager = std::make_unique<GeometryManager>(LUA);
+    m_bspManager = std::make_unique<BSPManager>(LUA);
+    m_cullManager = std::make_unique<CullManager>(LUA);
+
+    m_geometryManager->InitializeLuaBindings();
+    m_bspManager->InitializeLuaBindings();
+    m_cullManager->InitializeLuaBindings();
+
+    m_initialized = true;
+    Msg("[WorldAPI] Initialization complete\n");
+    return true;
+}
+
+void WorldAPI::Shutdown() {
+    if (!m_initialized) return;
+
+    m_cullManager.reset();
+    m_bspManager.reset();
+    m_geometryManager.reset();
+
+    m_lua = nullptr;
+    m_initialized = false;
+
+    Msg("[WorldAPI] Shutdown complete\n");
+}
+
+//=============================================================================
+// GeometryManager Implementation
+//=============================================================================
+GeometryManager::GeometryManager(GarrysMod::Lua::ILuaBase* LUA)
+    : m_lua(LUA)
+    , m_nextJobId(0) {
+}
+
+GeometryManager::~GeometryManager() {
+    // Running tasks notice the flag and finish early; the pool joins them when it is destroyed
+    CancelAllBuilds();
+    ReleaseWorld();
+    ReleaseDisplacements();
+}
+
+ThreadPool& GeometryManager::GetThreadPool() {
+    if (!m_threadPool) {
+        m_threadPool = std::make_unique<ThreadPool>();
+        Msg("[GeometryManager] Started %zu worker threads\n", m_threadPool->GetThreadCount());
+    }
+    return *m_threadPool;
+}
+
+// Cache lookup, build and cache refresh for one geometry kind. Runs on whichever thread calls
+// it; a cancelled build is neither logged as built nor written to the cache.
+static void ProduceWorld(const BSPFile& map, const WorldBuildSettings& settings, ThreadPool& pool,
+                         BuildProgress* progress, WorldBuildResult& out) {
+    const auto start = std::chrono::steady_clock::now();
+    const std::string cachePath = settings.useCache ? GetGeometryCachePath(map, "world") : std::string();
+    const uint64_t checksum = cachePath.empty() ? 0 : ComputeMapChecksum(map);
+    const uint64_t settingsHash = HashSettings(settings);
+
+    if (!cachePath.empty() && LoadGeometryCache(cachePath, checksum, settingsHash, out)) {
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        Msg("[GeometryManager] Loaded %zu world groups from cache in %.3f seconds\n", out.groups.size(), seconds);
+        return;
+    }
+
+    out = BuildWorldChunks(map, settings, pool, progress);
+    if (progress && progress->IsCancelled()) return;
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    Msg("[GeometryManager] Built %zu world groups from %zu faces in %.3f seconds (chunk size %d, %zu faces rejected)\n",
+        out.groups.size(), out.faceCount, seconds, out.chunkSize, out.rejectedFaces);
+
+    if (!cachePath.empty() && !SaveGeometryCache(cachePath, checksum, settingsHash, out)) {
+        Warning("[GeometryManager] Failed to write geometry cache %s\n", cachePath.c_str());
+    }
+}
+
+// Unwelded LOD levels of one triangle list; thread-safe
+static std::vector<std::vector<MeshVertex>> BuildTriangleLODChain(const std::vector<MeshVertex>& triangles,
+                                                                  const std::vector<float>& ratios,
+                                                                  const SimplifyOptions& options) {
+    std::vector<std::vector<MeshVertex>> result;
+
+    IndexedMesh welded = WeldTriangleSoup(triangles, options.weldEpsilon);
+    std::vector<IndexedMesh> chain = BuildLODChain(welded, ratios, options);
+
+    result.reserve(chain.size());
+    for (const IndexedMesh& level : chain) {
+        result.push_back(UnweldMesh(level));
+    }
+    return result;
+}
+
+// Positions where a group meets an earlier one: the chunk and material seams whose outline the
+// LOD levels must keep so neighbouring groups don't crack apart
+static SeamPositions CollectWorldSeams(const WorldBuildResult& world, float epsilon) {
+    SeamPositions seen(epsilon);
+    SeamPositions seams(epsilon);
+    for (const WorldChunkGroup& group : world.groups) {
+        for (const MeshVertex& vertex : group.vertices) {
+            if (seen.Contains(vertex.pos)) seams.Add(vertex.pos);
+        }
+        for (const MeshVertex& vertex : group.vertices) {
+            seen.Add(vertex.pos);
+        }
+    }
+    return seams;
+}
+
+// LOD chains for the groups settings asks for, simplified across the workers as a second build
+// stage. Every group gets an entry; skipped groups keep an empty chain.
+static void ProduceWorldLODs(const WorldBuildResult& world, const WorldBuildSettings& settings, ThreadPool& pool,
+                             BuildProgress* progress, std::vector<std::vector<std::vector<MeshVertex>>>& out) {
+    out.clear();
+    out.resize(world.groups.size());
+    if (settings.lodRatios.empty()) return;
+
+    const auto start = std::chrono::steady_clock::now();
+    const SeamPositions seams = CollectWorldSeams(world, settings.lodOptions.weldEpsilon);
+    SimplifyOptions options = settings.lodOptions;
+    options.seams = &seams;
+    if (progress) progress->SetTotal(world.groups.size());
+    pool.ParallelFor(world.groups.size(), [&](size_t g) {
+        if (progress && progress->IsCancelled()) return;
+        const std::vector<MeshVertex>& vertices = world.groups[g].vertices;
+        if (vertices.size() >= settings.lodMinVertices) {
+            out[g] = BuildTriangleLODChain(vertices, settings.lodRatios, options);
+        }
+        if (progress) progress->Advance();
+    });
+    if (progress && progress->IsCancelled()) return;
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    Msg("[GeometryManager] Built %zu-level LOD chains for %zu world groups in %.3f seconds\n",
+        settings.lodRatios.size(), world.groups.size(), seconds);
+}
+
+static void ProduceDisplacements(const BSPFile& map, const DisplacementBuildSettings& settings, ThreadPool& pool,
+                                 BuildProgress* progress, DisplacementBuildResult& out) {
+    const auto start = std::chrono::steady_clock::now();
+    const std::string cachePath = settings.useCache ? GetGeometryCachePath(map, "disp") : std::string();
+    const uint64_t checksum = cachePath.empty() ? 0 : ComputeMapChecksum(map);
+    const uint64_t settingsHash = HashSettings(settings);
+
+    if (!cachePath.empty() && LoadGeometryCache(cachePath, checksum, settingsHash, out)) {
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        Msg("[GeometryManager] Loaded %zu displacement batches from cache in %.3f seconds\n", out.groups.size(), seconds);
+        return;
+    }
+
+    out = BuildDisplacements(map, settings, pool, progress);
+    if (progress && progress->IsCancelled()) return;
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    Msg("[GeometryManager] Built %zu displacement batches from %zu displacements in %.3f seconds (%zu rejected)\n",
+        out.groups.size(), out.displacementCount, seconds, out.rejectedDisplacements);
+
+    if (!cachePath.empty() && !SaveGeometryCache(cachePath, checksum, settingsHash, out)) {
+        Warning("[GeometryManager] Failed to write geometry cache %s\n", cachePath.c_str());
+    }
+}
+
+bool GeometryManager::BuildWorld(const WorldBuildSettings& settings, std::string& error) {
+    auto map = WorldAPI::Instance().GetBSPManager().GetMap();
+    if (!map) {
+        error = "no map open";
+        return false;
+    }
+
+    ReleaseWorld();
+    ProduceWorld(*map, settings, GetThreadPool(), nullptr, m_world);
+    ProduceWorldLODs(m_world, settings, GetThreadPool(), nullptr, m_worldLods);
+    return true;
+}
+
+void GeometryManager::ReleaseWorld() {
+    m_world = WorldBuildResult();
+    m_worldLods.clear();
+}
+
+bool GeometryManager::BuildDisplacements(const DisplacementBuildSettings& settings, std::string& error) {
+    auto map = WorldAPI::Instance().GetBSPManager().GetMap();
+    if (!map) {
+        error = "no map open";
+        return false;
+    }
+
+    ReleaseDisplacements();
+    ProduceDisplacements(*map, settings, GetThreadPool(), nullptr, m_displacements);
+    return true;
+}
+
+void GeometryManager::ReleaseDisplacements() {
+    m_displacements = DisplacementBuildResult();
+}
+
+uint32_t GeometryManager::StartWorldBuild(const WorldBuildSettings& settings, std::string& error) {
+    auto job = std::make_shared<BuildJob>();
+    job->kind = BuildKind::World;
+    job->worldSettings = settings;
+    return StartBuild(job, error);
+}
+
+uint32_t GeometryManager::StartDisplacementBuild(const DisplacementBuildSettings& settings, std::string& error) {
+    auto job = std::make_shared<BuildJob>();
+    job->kind = BuildKind::Displacements;
+    job->displacementSettings = settings;
+    return StartBuild(job, error);
+}
+
+uint32_t GeometryManager::StartBuild(const std::shared_ptr<BuildJob>& job, std::string& error) {
+    auto map = WorldAPI::Instance().GetBSPManager().GetMap();
+    if (!map) {
+        error = "no map open";
+        return 0;
+    }
+
+    // A newer build of the same kind supersedes the running one
+    for (auto it = m_jobs.begin(); it != m_jobs.end();) {
+        if (it->second->kind == job->kind) {
+            it->second->progress.Cancel();
+            it = m_jobs.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    job->id = ++m_nextJobId;
+    m_jobs[job->id] = job;
+
+    // The task keeps the job and the map alive; the pool outlives every queued task
+    ThreadPool& pool = GetThreadPool();
+    pool.Enqueue([job, map, &pool]() {
+        try {
+            if (job->kind == BuildKind::World) {
+                ProduceWorld(*map, job->worldSettings, pool, &job->progress, job->world);
+                if (!job->progress.IsCancelled()) {
+                    ProduceWorldLODs(job->world, job->worldSettings, pool, &job->progress, job->worldLods);
+                }
+            } else {
+                ProduceDisplacements(*map, job->displacementSettings, pool, &job->progress, job->displacements);
+            }
+            job->state.store(job->progress.IsCancelled() ? BuildState::Cancelled : BuildState::Done);
+        } catch (const std::exception& e) {
+            job->error = e.what();
+            job->state.store(BuildState::Failed);
+        } catch (...) {
+            job->error = "unknown exception";
+            job->state.store(BuildState::Failed);
+        }
+    });
+    return job->id;
+}
+
+BuildState GeometryManager::PollBuild(uint32_t jobId, BuildKind& kind, float& progress, std::string& error) {
+    auto it = m_jobs.find(jobId);
+    if (it == m_jobs.end()) {
+        progress = 0.0f;
+        return BuildState::Cancelled;
+    }
+
+    std::shared_ptr<BuildJob> job = it->second;
+    kind = job->kind;
+    progress = job->progress.GetFraction();
+
+    const BuildState state = job->state.load();
+    if (state == BuildState::Running) return state;
+
+    m_jobs.erase(it);
+    if (state == BuildState::Failed) {
+        error = job->error;
+        Warning("[GeometryManager] Background build failed: %s\n", error.c_str());
+    } else if (state == BuildState::Done) {
+        progress = 1.0f;
+        if (kind == BuildKind::World) {
+            m_world = std::move(job->world);
+            m_worldLods = std::move(job->worldLods);
+            m_worldLods.resize(m_world.groups.size());
+        } else {
+            m_displacements = std::move(job->displacements);
+        }
+    }
+    return state;
+}
+
+void GeometryManager::CancelBuild(uint32_t jobId) {
+    auto it = m_jobs.find(jobId);
+    if (it == m_jobs.end()) return;
+
+    it->second->progress.Cancel();
+    m_jobs.erase(it);
+}
+
+void GeometryManager::CancelAllBuilds() {
+    for (auto& entry : m_jobs) {
+        entry.second->progress.Cancel();
+    }
+    m_jobs.clear();
+}
+
+size_t GeometryManager::BuildWorldGroupLODs(size_t groupIndex, const std::vector<float>& ratios, const SimplifyOptions& options) {
+    if (groupIndex >= m_world.groups.size()) return 0;
+
+    // One group alone doesn't know where its neighbours are, so its whole outline stays put
+    SimplifyOptions groupOptions = options;
+    groupOptions.lockBorders = true;
+    m_worldLods[groupIndex] = BuildTriangleLODChain(m_world.groups[groupIndex].vertices, ratios, groupOptions);
+    return m_worldLods[groupIndex].size();
+}
+
+const std::vector<MeshVertex>* GeometryManager::GetWorldGroupVertices(size_t groupIndex, size_t level) const {
+    if (groupIndex >= m_world.groups.size()) return nullptr;
+    if (level == 0) return &m_world.groups[groupIndex].vertices;
+
+    const auto& lods = m_worldLods[groupIndex];
+    return level <= lods.size() ? &lods[level - 1] : nullptr;
+}
+
+size_t GeometryManager::GetWorldGroupLODCount(size_t groupIndex) const {
+    return groupIndex < m_worldLods.size() ? m_worldLods[groupIndex].size() : 0;
+}
+
+std::vector<MeshVertex> GeometryManager::SimplifyTriangles(const std::vector<MeshVertex>& triangles, const SimplifyOptions& options) {
+    IndexedMesh welded = WeldTriangleSoup(triangles, options.weldEpsilon);
+    IndexedMesh simplified = SimplifyMesh(welded, options);
+    return UnweldMesh(simplified);
+}
+
+std::vector<std::vector<MeshVertex>> GeometryManager::BuildLODChain(const std::vector<MeshVertex>& triangles,
+                                                                    const std::vector<float>& ratios,
+                                                                    const SimplifyOptions& options) {
+    return BuildTriangleLODChain(triangles, ratios, options);
+}
+
+//=============================================================================
+// BSPManager Implementation
+//=============================================================================
+BSPManager::BSPManager(GarrysMod::Lua::ILuaBase* LUA)
+    : m_lua(LUA) {
+}
+
+BSPManager::~BSPManager() {
+    CloseMap();
+}
+
+bool BSPManager::OpenMap(const std::string& relativePath, std::string& error) {
+    const std::string fullPath = ResolveGamePath(relativePath);
+    if (fullPath.empty()) {
+        error = relativePath + " is not on disk";
+        return false;
+    }
+
+    auto map = std::make_shared<BSPFile>();
+    if (!map->Open(fullPath)) {
+        error = map->GetLastError();
+        Warning("[BSPManager] Failed to open %s: %s\n", fullPath.c_str(), error.c_str());
+        return false;
+    }
+
+    Msg("[BSPManager] Mapped %s (v%d, %zu bytes)\n", relativePath.c_str(), map->GetVersion(), map->GetFileSize());
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_map = std::move(map);
+    }
+    OnMapChanged();
+    return true;
+}
+
+bool BSPManager::OpenMapFromBuffer(std::string&& data, const std::string& name, std::string& error) {
+    auto map = std::make_shared<BSPFile>();
+    if (!map->OpenFromBuffer(std::move(data), name)) {
+        error = map->GetLastError();
+        Warning("[BSPManager] Failed to load %s: %s\n", name.c_str(), error.c_str());
+        return false;
+    }
+
+    Msg("[BSPManager] Loaded %s from buffer (v%d, %zu bytes)\n", name.c_str(), map->GetVersion(), map->GetFileSize());
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_map = std::move(map);
+    }
+    OnMapChanged();
+    return true;
+}
+
+void BSPManager::CloseMap() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_map.reset();
+    }
+    OnMapChanged();
+}
+
+void BSPManager::OnMapChanged() {
+    m_chunkSets.clear();
+    m_visibility.Clear();
+    m_portals.Clear();
+    m_portalFlowValid = false;
+
+    auto map = GetMap();
+    if (map && m_visibility.Load(*map)) {
+        Msg("[BSPManager] Decoded PVS for %zu clusters\n", m_visibility.GetClusterCount());
+    }
+}
+
+int BSPManager::FindCluster(float x, float y, float z) const {
+    auto map = GetMap();
+    if (!map) return -1;
+
+    const int leaf = map->FindLeaf(x, y, z);
+    return leaf >= 0 ? map->Leafs()[leaf].cluster : -1;
+}
+
+size_t BSPManager::RegisterChunk(const std::string& setName, const std::vector<int32_t>& clusters) {
+    auto it = m_chunkSets.find(setName);
+    if (it == m_chunkSets.end()) {
+        it = m_chunkSets.emplace(setName, ChunkClusterMasks()).first;
+        it->second.Reset(m_visibility.GetClusterCount());
+    }
+    return it->second.Add(clusters);
+}
+
+void BSPManager::ClearChunks(const std::string& setName) {
+    m_chunkSets.erase(setName);
+}
+
+void BSPManager::QueryVisibleChunks(const std::string& setName, int viewCluster, std::vector<uint32_t>& out) const {
+    out.clear();
+    auto it = m_chunkSets.find(setName);
+    if (it != m_chunkSets.end()) {
+        it->second.QueryVisible(m_visibility, viewCluster, out);
+    }
+}
+
+bool BSPManager::LoadPortals(std::string_view text, std::string& error) {
+    m_portals.Clear();
+    m_portalFlowValid = false;
+
+    if (!m_visibility.IsLoaded()) {
+        error = "the open map has no PVS to match portals against";
+        return false;
+    }
+
+    PortalGraph portals;
+    if (!portals.Load(text, error)) {
+        Warning("[BSPManager] Failed to load portals: %s\n", error.c_str());
+        return false;
+    }
+    if (portals.GetClusterCount() != m_visibility.GetClusterCount()) {
+        error = "portal file has " + std::to_string(portals.GetClusterCount()) + " clusters, map has " +
+            std::to_string(m_visibility.GetClusterCount());
+        Warning("[BSPManager] Ignoring portals: %s\n", error.c_str());
+        return false;
+    }
+
+    m_portals = std::move(portals);
+    Msg("[BSPManager] Loaded %zu portals between %zu clusters\n", m_portals.GetPortalCount(), m_portals.GetClusterCount());
+    return true;
+}
+
+bool BSPManager::QueryPortalVisibleChunks(const std::string& setName, const Frustum& view, std::vector<uint32_t>& out) {
+    out.clear();
+    if (!m_portals.IsLoaded()) return false;
+
+    // Both world passes (and every renderer) query the same view each frame
+    if (!m_portalFlowValid || std::memcmp(&view, &m_portalView, sizeof(Frustum)) != 0) {
+        const int viewCluster = FindCluster(view.origin[0], view.origin[1], view.origin[2]);
+        m_portalFlowOk = m_portals.FlowVisible(view, viewCluster, m_visibility.GetRow(viewCluster), m_portalRow);
+        m_portalView = view;
+        m_portalFlowValid = true;
+    }
+    if (!m_portalFlowOk) return false;
+
+    auto it = m_chunkSets.find(setName);
+    if (it == m_chunkSets.end()) return true;
+    if (it->second.GetWordsPerMask() != m_portalRow.size()) return false;
+    it->second.QueryVisibleRow(m_portalRow.data(), out);
+    return true;
+}
+
+std::shared_ptr<const BSPFile> BSPManager::GetMap() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_map;
+}
+
+//=============================================================================
+// CullManager Implementation
+//=============================================================================
+CullManager::CullManager(GarrysMod::Lua::ILuaBase* LUA)
+    : m_lua(LUA)
+    , m_view()
+    , m_hasView(false) {
+}
+
+CullManager::~CullManager() {
+    ClearAll();
+}
+
+void CullManager::SetView(const Frustum& frustum) {
+    m_view = frustum;
+    m_hasView = true;
+}
+
+SpatialIndex& CullManager::GetIndex(const std::string& name) {
+    return m_indices[name];
+}
+
+SpatialIndex* CullManager::FindIndex(const std::string& name) {
+    auto it = m_indices.find(name);
+    return it != m_indices.end() ? &it->second : nullptr;
+}
+
+void CullManager::ClearIndex(const std::string& name) {
+    m_indices.erase(name);
+}
+
+void CullManager::ClearAll() {
+    m_indices.clear();
+    m_hasView = false;
+}
+
+} // namespace WorldAPI
@@ -0,0 +1,201 @@
+#pragma once
+#include "GarrysMod/Lua/Interface.h"
+
+#include "bsp_file.h"
+#include "build_job.h"
+#include "displacement_builder.h"
+#include "material_filter.h"
+#include "mesh_simplifier.h"
+#include "portal_flow.h"
+#include "spatial_index.h"
+#include "thread_pool.h"
+#include "visibility.h"
+#include "world_builder.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// World geometry helpers. Unlike RemixAPI this has no Remix dependency, so it is
+// built for every architecture; only the paths that hand data to Remix are _WIN64 only.
+namespace WorldAPI {
+    // Forward declarations
+    class GeometryManager;
+    class BSPManager;
+    class CullManager;
+
+    // Main WorldAPI class
+    class WorldAPI {
+    public:
+        static WorldAPI& Instance();
+
+        // Core initialization
+        bool Initialize(GarrysMod::Lua::ILuaBase* LUA);
+        void Shutdown();
+
+        // Manager access
+        GeometryManager& GetGeometryManager() { return *m_geometryManager; }
+        BSPManager& GetBSPManager() { return *m_bspManager; }
+        CullManager& GetCullManager() { return *m_cullManager; }
+
+    private:
+        WorldAPI();
+        ~WorldAPI();
+
+        GarrysMod::Lua::ILuaBase* m_lua;
+
+        std::unique_ptr<GeometryManager> m_geometryManager;
+        std::unique_ptr<BSPManager> m_bspManager;
+        std::unique_ptr<CullManager> m_cullManager;
+
+        bool m_initialized;
+    };
+
+    // Geometry processing (world chunk building, simplification, LODs)
+    class GeometryManager {
+    public:
+        GeometryManager(GarrysMod::Lua::ILuaBase* LUA);
+        ~GeometryManager();
+
+        // Builds world chunks from the map opened in BSPManager and keeps them until released
+        bool BuildWorld(const WorldBuildSettings& settings, std::string& error);
+        void ReleaseWorld();
+        const WorldBuildResult& GetWorld() const { return m_world; }
+
+        // Builds LOD levels for one built world group on the calling thread; returns the number
+        // of levels kept. Builds given lodRatios already computed them on the workers.
+        size_t BuildWorldGroupLODs(size_t groupIndex, const std::vector<float>& ratios, const SimplifyOptions& options);
+        // Level 0 is the full-detail triangle list; nullptr if the group or level does not exist
+        const std::vector<MeshVertex>* GetWorldGroupVertices(size_t groupIndex, size_t level) const;
+        size_t GetWorldGroupLODCount(size_t groupIndex) const;
+
+        // Tessellates and batches the open map's displacements and keeps them until released
+        bool BuildDisplacements(const DisplacementBuildSettings& settings, std::string& error);
+        void ReleaseDisplacements();
+        const DisplacementBuildResult& GetDisplacements() const { return m_displacements; }
+
+        // Background builds: cache lookup, triangulation and binning run on the worker threads
+        // while the game keeps rendering. Starting a build cancels a running one of the same kind.
+        // Returns 0 and sets error when no map is open.
+        uint32_t StartWorldBuild(const WorldBuildSettings& settings, std::string& error);
+        uint32_t StartDisplacementBuild(const DisplacementBuildSettings& settings, std::string& error);
+        // Game thread only. Done installs the result as GetWorld()/GetDisplacements() and
+        // forgets the job; unknown or cancelled jobs report Cancelled.
+        BuildState PollBuild(uint32_t jobId, BuildKind& kind, float& progress, std::string& error);
+        void CancelBuild(uint32_t jobId);
+        void CancelAllBuilds();
+
+        // Simplifies a triangle list and returns it as a triangle list again
+        std::vector<MeshVertex> SimplifyTriangles(const std::vector<MeshVertex>& triangles, const SimplifyOptions& options);
+
+        // Builds progressively coarser triangle lists for the given ratios of the source
+        std::vector<std::vector<MeshVertex>> BuildLODChain(const std::vector<MeshVertex>& triangles,
+                                                           const std::vector<float>& ratios,
+                                                           const SimplifyOptions& options);
+
+        // Compiled whitelist/blacklist filters and their per-material verdicts (game thread)
+        MaterialVerdictCache& GetMaterialVerdicts() { return m_materialVerdicts; }
+
+        // Lua bindings
+        void InitializeLuaBindings();
+
+        // Shared workers for the native world passes (created on first use)
+        ThreadPool& GetThreadPool();
+
+    private:
+        GarrysMod::Lua::ILuaBase* m_lua;
+        std::unique_ptr<ThreadPool> m_threadPool;
+
+        WorldBuildResult m_world;
+        std::vector<std::vector<std::vector<MeshVertex>>> m_worldLods; // group -> level - 1 -> triangles
+
+        DisplacementBuildResult m_displacements;
+        MaterialVerdictCache m_materialVerdicts;
+
+        uint32_t StartBuild(const std::shared_ptr<BuildJob>& job, std::string& error);
+
+        std::unordered_map<uint32_t, std::shared_ptr<BuildJob>> m_jobs;
+        uint32_t m_nextJobId;
+    };
+
+    // Map file access
+    class BSPManager {
+    public:
+        BSPManager(GarrysMod::Lua::ILuaBase* LUA);
+        ~BSPManager();
+
+        // Opens a GAME-relative map path ("maps/<name>.bsp") found on disk
+        bool OpenMap(const std::string& relativePath, std::string& error);
+        // Takes ownership of map bytes read through Lua (maps mounted from GMAs)
+        bool OpenMapFromBuffer(std::string&& data, const std::string& name, std::string& error);
+        void CloseMap();
+
+        // The open map stays alive for as long as any holder keeps the pointer, so
+        // background work can continue safely across a CloseMap()
+        std::shared_ptr<const BSPFile> GetMap() const;
+
+        // PVS of the open map (decoded on open) and per-renderer chunk cluster masks
+        const ClusterVisibility& GetVisibility() const { return m_visibility; }
+        int FindCluster(float x, float y, float z) const;
+        size_t RegisterChunk(const std::string& setName, const std::vector<int32_t>& clusters);
+        void ClearChunks(const std::string& setName);
+        void QueryVisibleChunks(const std::string& setName, int viewCluster, std::vector<uint32_t>& out) const;
+
+        // Portal graph of the open map, from the .prt file vbsp wrote next to it. Rejected
+        // when its cluster count does not match the map's PVS (a stale or foreign file).
+        bool LoadPortals(std::string_view text, std::string& error);
+        bool HasPortals() const { return m_portals.IsLoaded(); }
+        // Chunks seen from the view through the portal graph. False when there is no portal
+        // flow for this view (no portal file, view outside the map, flow over budget); callers
+        // then fall back to the PVS. The flow is reused until the view changes.
+        bool QueryPortalVisibleChunks(const std::string& setName, const Frustum& view, std::vector<uint32_t>& out);
+
+        // Lua bindings
+        void InitializeLuaBindings();
+
+    private:
+        void OnMapChanged();
+
+        GarrysMod::Lua::ILuaBase* m_lua;
+        mutable std::mutex m_mutex;
+        std::shared_ptr<const BSPFile> m_map;
+
+        ClusterVisibility m_visibility;
+        std::unordered_map<std::string, ChunkClusterMasks> m_chunkSets;
+
+        PortalGraph m_portals;
+        Frustum m_portalView = {};
+        bool m_portalFlowValid = false;   // m_portalRow matches m_portalView
+        bool m_portalFlowOk = false;
+        std::vector<uint64_t> m_portalRow;
+    };
+
+    // Per-frame culling of renderer bins against named spatial indices
+    class CullManager {
+    public:
+        CullManager(GarrysMod::Lua::ILuaBase* LUA);
+        ~CullManager();
+
+        // Current view volume, set once per frame by the render core
+        void SetView(const Frustum& frustum);
+        const Frustum* GetView() const { return m_hasView ? &m_view : nullptr; }
+
+        // Named indices ("displacements", "staticprops", ...) are created on first use
+        SpatialIndex& GetIndex(const std::string& name);
+        SpatialIndex* FindIndex(const std::string& name);
+        void ClearIndex(const std::string& name);
+        void ClearAll();
+
+        // Lua bindings
+        void InitializeLuaBindings();
+
+    private:
+        GarrysMod::Lua::ILuaBase* m_lua;
+
+        std::unordered_map<std::string, SpatialIndex> m_indices;
+        Frustum m_view;
+        bool m_hasView;
+    };
+}